@@ -0,0 +1,100 @@
+import argparse
+import glob
+import json
+import os
+import subprocess
+import sys
+import tempfile
+
+
+def run(args):
+    executables = sorted(glob.glob(os.path.join(args.build_dir, 'bm_*')))
+    executables = [path for path in executables if os.access(path, os.X_OK) and not os.path.isdir(path)]
+    if not executables:
+        sys.exit(f'no benchmark executables found in {args.build_dir}')
+
+    result = {'context': None, 'benchmarks': []}
+    for path in executables:
+        name = os.path.basename(path)
+        with tempfile.TemporaryDirectory() as directory:
+            output = os.path.join(directory, 'out.json')
+            command = [path, '--benchmark_out_format=json', f'--benchmark_out={output}',
+                       f'--benchmark_repetitions={args.repetitions}']
+            if args.repetitions > 1:
+                command.append('--benchmark_report_aggregates_only=true')
+            if args.filter:
+                command.append(f'--benchmark_filter={args.filter}')
+            if args.min_time:
+                command.append(f'--benchmark_min_time={args.min_time}')
+            print(f'running {name}', file=sys.stderr)
+            subprocess.run(command, check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+            if not os.path.exists(output) or os.path.getsize(output) == 0:
+                continue
+            with open(output) as file:
+                data = json.load(file)
+        if result['context'] is None:
+            result['context'] = data['context']
+        for benchmark in data['benchmarks']:
+            benchmark['executable'] = name
+            result['benchmarks'].append(benchmark)
+
+    with open(args.output, 'w') as file:
+        json.dump(result, file, indent=2)
+
+
+def load(filepath, metric):
+    with open(filepath) as file:
+        data = json.load(file)
+    result = {}
+    for benchmark in data['benchmarks']:
+        if benchmark.get('run_type') == 'aggregate' and benchmark.get('aggregate_name') != 'median':
+            continue
+        if benchmark.get('error_occurred'):
+            continue
+        key = (benchmark.get('executable', ''), benchmark.get('run_name', benchmark['name']))
+        result[key] = (benchmark[metric], benchmark['time_unit'])
+    return result
+
+
+def compare(args):
+    baseline = load(args.baseline, args.metric)
+    current = load(args.current, args.metric)
+    regressions = []
+    width = max((len(f'{e}/{n}') for e, n in baseline.keys() & current.keys()), default=0)
+    for key in sorted(baseline.keys() & current.keys()):
+        (old, unit), (new, _) = baseline[key], current[key]
+        change = (new - old) / old if old else 0.0
+        flag = ''
+        if change > args.threshold:
+            flag = 'REGRESSION'
+            regressions.append(key)
+        elif change < -args.threshold:
+            flag = 'improvement'
+        label = f'{key[0]}/{key[1]}'
+        print(f'{label:<{width}}  {old:>12.2f} {unit:<2}  {new:>12.2f} {unit:<2}  {change:>+8.1%}  {flag}')
+    for key in sorted(baseline.keys() - current.keys()):
+        print(f'{key[0]}/{key[1]}: missing from {args.current}')
+    print(f'{len(regressions)} regression(s) above {args.threshold:.0%}')
+    sys.exit(1 if regressions else 0)
+
+
+parser = argparse.ArgumentParser(description='Run the benchmark suite and compare JSON baselines.')
+commands = parser.add_subparsers(dest='command', required=True)
+
+run_parser = commands.add_parser('run', help='run every bm_* executable and write one JSON file')
+run_parser.add_argument('--build-dir', default='build')
+run_parser.add_argument('--output', default='baseline.json')
+run_parser.add_argument('--filter', default='')
+run_parser.add_argument('--repetitions', type=int, default=1)
+run_parser.add_argument('--min-time', default='')
+run_parser.set_defaults(function=run)
+
+compare_parser = commands.add_parser('compare', help='flag benchmarks that regressed beyond a threshold')
+compare_parser.add_argument('baseline')
+compare_parser.add_argument('current')
+compare_parser.add_argument('--threshold', type=float, default=0.05)
+compare_parser.add_argument('--metric', choices=['real_time', 'cpu_time'], default='cpu_time')
+compare_parser.set_defaults(function=compare)
+
+args = parser.parse_args()
+args.function(args)
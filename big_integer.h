@@ -0,0 +1,652 @@
+#pragma once
+
+#include "convolution.h"
+#include "int_m.h"
+#include "integral.h"
+#include "standard.h"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace big {
+
+			using limbs = ::std::vector<::concrete::uint64_t>;
+
+			constexpr ::std::size_t karatsuba_threshold{32};
+			constexpr ::std::size_t ntt_threshold{4096};
+			constexpr ::std::size_t ntt_limit{1 << 22};
+			constexpr ::std::size_t newton_threshold{64};
+			constexpr ::std::size_t conversion_threshold{32};
+			constexpr ::concrete::uint64_t decimal_base{10000000000000000000u};
+			constexpr ::std::size_t decimal_digits{19};
+
+			inline void trim(limbs& x) noexcept {
+				while (!x.empty() && x.back() == 0) {
+					x.pop_back();
+				}
+			}
+
+			inline int compare(const limbs& x, const limbs& y) noexcept {
+				if (x.size() != y.size()) {
+					return x.size() < y.size() ? -1 : 1;
+				}
+				for (::std::size_t i{x.size()}; i-- != 0;) {
+					if (x[i] != y[i]) {
+						return x[i] < y[i] ? -1 : 1;
+					}
+				}
+				return 0;
+			}
+
+			inline unsigned char add_to(::concrete::uint64_t* z, ::std::size_t zSize, const ::concrete::uint64_t* x, ::std::size_t xSize) noexcept {
+				unsigned char carry{0};
+				::std::size_t i{0};
+				for (; i != xSize; ++i) {
+					carry = ::concrete::detail::wide::add_carry(carry, z[i], x[i], z[i]);
+				}
+				for (; carry != 0 && i != zSize; ++i) {
+					carry = ::concrete::detail::wide::add_carry(carry, z[i], 0, z[i]);
+				}
+				return carry;
+			}
+
+			inline unsigned char subtract_from(::concrete::uint64_t* z, ::std::size_t zSize, const ::concrete::uint64_t* x, ::std::size_t xSize) noexcept {
+				unsigned char borrow{0};
+				::std::size_t i{0};
+				for (; i != xSize; ++i) {
+					borrow = ::concrete::detail::wide::subtract_borrow(borrow, z[i], x[i], z[i]);
+				}
+				for (; borrow != 0 && i != zSize; ++i) {
+					borrow = ::concrete::detail::wide::subtract_borrow(borrow, z[i], 0, z[i]);
+				}
+				return borrow;
+			}
+
+			inline limbs add(const limbs& x, const limbs& y) {
+				const limbs& a{x.size() < y.size() ? y : x};
+				const limbs& b{x.size() < y.size() ? x : y};
+				limbs res(a.size() + 1);
+				::std::copy(a.begin(), a.end(), res.begin());
+				::concrete::detail::big::add_to(res.data(), res.size(), b.data(), b.size());
+				::concrete::detail::big::trim(res);
+				return res;
+			}
+
+			inline limbs subtract(const limbs& x, const limbs& y) {
+				limbs res{x};
+				::concrete::detail::big::subtract_from(res.data(), res.size(), y.data(), y.size());
+				::concrete::detail::big::trim(res);
+				return res;
+			}
+
+			inline ::concrete::uint64_t multiply_word(limbs& x, ::concrete::uint64_t y, ::concrete::uint64_t carry) noexcept {
+				for (::concrete::uint64_t& v : x) {
+					::concrete::uint64_t high{}, low{::concrete::detail::wide::multiply(v, y, high)};
+					high += ::concrete::detail::wide::add_carry(0, low, carry, v);
+					carry = high;
+				}
+				return carry;
+			}
+
+			inline ::concrete::uint64_t divide_word(limbs& x, ::concrete::uint64_t y) noexcept {
+				::concrete::uint64_t rem{0};
+				for (::std::size_t i{x.size()}; i-- != 0;) {
+					x[i] = ::concrete::detail::wide::divide(rem, x[i], y, rem);
+				}
+				::concrete::detail::big::trim(x);
+				return rem;
+			}
+
+			inline void schoolbook(const ::concrete::uint64_t* x, ::std::size_t xSize, const ::concrete::uint64_t* y, ::std::size_t ySize, ::concrete::uint64_t* z) noexcept {
+				for (::std::size_t i{0}; i != xSize; ++i) {
+					::concrete::uint64_t carry{0};
+					for (::std::size_t j{0}; j != ySize; ++j) {
+						::concrete::uint64_t high{}, low{::concrete::detail::wide::multiply(x[i], y[j], high)};
+						high += ::concrete::detail::wide::add_carry(0, z[i + j], low, z[i + j]);
+						high += ::concrete::detail::wide::add_carry(0, z[i + j], carry, z[i + j]);
+						carry = high;
+					}
+					z[i + ySize] = carry;
+				}
+			}
+
+			constexpr ::std::size_t karatsuba_scratch(::std::size_t size) noexcept {
+				if (size <= karatsuba_threshold) {
+					return 0;
+				}
+				::std::size_t high{size - (size >> 1)};
+				return ((high + 1) << 2) + ::concrete::detail::big::karatsuba_scratch(high + 1);
+			}
+
+			inline void karatsuba(const ::concrete::uint64_t* x, const ::concrete::uint64_t* y, ::std::size_t size, ::concrete::uint64_t* z, ::concrete::uint64_t* scratch) noexcept {
+				if (size <= karatsuba_threshold) {
+					::std::fill(z, z + (size << 1), 0);
+					::concrete::detail::big::schoolbook(x, size, y, size, z);
+					return;
+				}
+				::std::size_t low{size >> 1}, high{size - low};
+				::concrete::detail::big::karatsuba(x, y, low, z, scratch);
+				::concrete::detail::big::karatsuba(x + low, y + low, high, z + (low << 1), scratch);
+				::concrete::uint64_t* sx{scratch};
+				::concrete::uint64_t* sy{sx + high + 1};
+				::concrete::uint64_t* middle{sy + high + 1};
+				::std::size_t middleSize{(high + 1) << 1};
+				::std::copy(x + low, x + size, sx);
+				::std::copy(y + low, y + size, sy);
+				sx[high] = 0;
+				sy[high] = 0;
+				::concrete::detail::big::add_to(sx, high + 1, x, low);
+				::concrete::detail::big::add_to(sy, high + 1, y, low);
+				::concrete::detail::big::karatsuba(sx, sy, high + 1, middle, middle + middleSize);
+				::concrete::detail::big::subtract_from(middle, middleSize, z, low << 1);
+				::concrete::detail::big::subtract_from(middle, middleSize, z + (low << 1), high << 1);
+				::std::size_t count{middleSize < (size << 1) - low ? middleSize : (size << 1) - low};
+				::concrete::detail::big::add_to(z + low, (size << 1) - low, middle, count);
+			}
+
+			inline limbs ntt_multiply(const limbs& x, const limbs& y) {
+				using namespace ::concrete::detail::ntt::garner;
+				auto split{[](const limbs& v) {
+					::std::vector<::concrete::uint32_t> res(v.size() << 2);
+					for (::std::size_t i{0}; i != res.size(); ++i) {
+						res[i] = (::concrete::uint32_t)(v[i >> 2] >> ((i & 3) << 4) & 0xffff);
+					}
+					return res;
+				}};
+				::std::vector<::concrete::uint32_t> a{split(x)};
+				::std::vector<::concrete::uint32_t> b{&x == &y ? ::std::vector<::concrete::uint32_t>{} : split(y)};
+				const ::std::vector<::concrete::uint32_t>& c{&x == &y ? a : b};
+				::std::vector<int_m1> a1{::concrete::detail::ntt::convolve<int_m1>(a, c, true)};
+				::std::vector<int_m2> a2{::concrete::detail::ntt::convolve<int_m2>(a, c, true)};
+				const int_m2 inverse1{::concrete::inverse(int_m2{p1})};
+				limbs res(x.size() + y.size());
+				::concrete::uint64_t carry{0};
+				for (::std::size_t i{0}; i != res.size() << 2; ++i) {
+					if (i < a.size() + c.size() - 1) {
+						::concrete::uint64_t x1{(::concrete::uint32_t)a1[i]};
+						carry += x1 + (::concrete::uint64_t)p1 * (::concrete::uint32_t)((a2[i] - int_m2{(::concrete::uint32_t)x1}) * inverse1);
+					}
+					res[i >> 2] |= (carry & 0xffff) << ((i & 3) << 4);
+					carry >>= 16;
+				}
+				return res;
+			}
+
+			inline limbs multiply(const limbs& x, const limbs& y) {
+				if (x.empty() || y.empty()) {
+					return {};
+				}
+				const limbs& a{x.size() < y.size() ? y : x};
+				const limbs& b{x.size() < y.size() ? x : y};
+				limbs res(a.size() + b.size());
+				if (b.size() <= karatsuba_threshold) {
+					::concrete::detail::big::schoolbook(a.data(), a.size(), b.data(), b.size(), res.data());
+				}
+				else if (b.size() >= ntt_threshold && a.size() + b.size() <= ntt_limit) {
+					res = ::concrete::detail::big::ntt_multiply(x, y);
+				}
+				else {
+					limbs t((b.size() << 1) + ::concrete::detail::big::karatsuba_scratch(b.size()));
+					for (::std::size_t i{0}; i < a.size(); i += b.size()) {
+						if (a.size() - i >= b.size()) {
+							::concrete::detail::big::karatsuba(a.data() + i, b.data(), b.size(), t.data(), t.data() + (b.size() << 1));
+							::concrete::detail::big::add_to(res.data() + i, res.size() - i, t.data(), b.size() << 1);
+						}
+						else {
+							limbs rest{::concrete::detail::big::multiply(limbs(a.begin() + i, a.end()), b)};
+							::concrete::detail::big::add_to(res.data() + i, res.size() - i, rest.data(), rest.size());
+						}
+					}
+				}
+				::concrete::detail::big::trim(res);
+				return res;
+			}
+
+			inline limbs shift_limbs(const limbs& x, ::std::ptrdiff_t count) {
+				if (count >= 0) {
+					limbs res(x.size() + count);
+					::std::copy(x.begin(), x.end(), res.begin() + count);
+					return res;
+				}
+				if ((::std::size_t)-count >= x.size()) {
+					return {};
+				}
+				return limbs(x.begin() - count, x.end());
+			}
+
+			inline void schoolbook_divide(const limbs& x, const limbs& y, limbs& quotient, limbs& remainder) {
+				if (y.size() == 1) {
+					quotient = x;
+					::concrete::uint64_t rem{::concrete::detail::big::divide_word(quotient, y[0])};
+					remainder = rem != 0 ? limbs{rem} : limbs{};
+					return;
+				}
+				::std::size_t n{x.size()}, m{y.size()};
+				unsigned shift{(unsigned)::concrete::countl_zero(y.back())};
+				limbs a(n + 1), b(m);
+				for (::std::size_t i{0}; i != m; ++i) {
+					b[i] = y[i] << shift | (shift != 0 && i != 0 ? y[i - 1] >> (64 - shift) : 0);
+				}
+				for (::std::size_t i{0}; i != n + 1; ++i) {
+					::concrete::uint64_t v{i != n ? x[i] << shift : 0};
+					a[i] = v | (shift != 0 && i != 0 ? x[i - 1] >> (64 - shift) : 0);
+				}
+				quotient.assign(n - m + 1, 0);
+				for (::std::size_t j{n - m + 1}; j-- != 0;) {
+					::concrete::uint64_t q{}, r{};
+					bool overflow{false};
+					if (a[j + m] >= b[m - 1]) {
+						q = ~(::concrete::uint64_t)0;
+						overflow = ::concrete::detail::wide::add_carry(0, a[j + m - 1], b[m - 1], r) != 0;
+					}
+					else {
+						q = ::concrete::detail::wide::divide(a[j + m], a[j + m - 1], b[m - 1], r);
+					}
+					while (!overflow) {
+						::concrete::uint64_t high{}, low{::concrete::detail::wide::multiply(q, b[m - 2], high)};
+						if (high < r || (high == r && low <= a[j + m - 2])) {
+							break;
+						}
+						--q;
+						overflow = ::concrete::detail::wide::add_carry(0, r, b[m - 1], r) != 0;
+					}
+					::concrete::uint64_t carry{0};
+					unsigned char borrow{0};
+					for (::std::size_t i{0}; i != m; ++i) {
+						::concrete::uint64_t high{}, low{::concrete::detail::wide::multiply(q, b[i], high)};
+						high += ::concrete::detail::wide::add_carry(0, low, carry, low);
+						carry = high;
+						borrow = ::concrete::detail::wide::subtract_borrow(borrow, a[i + j], low, a[i + j]);
+					}
+					borrow = ::concrete::detail::wide::subtract_borrow(borrow, a[j + m], carry, a[j + m]);
+					if (borrow != 0) {
+						--q;
+						::concrete::detail::big::add_to(a.data() + j, m + 1, b.data(), m);
+					}
+					quotient[j] = q;
+				}
+				remainder.assign(m, 0);
+				for (::std::size_t i{0}; i != m; ++i) {
+					remainder[i] = a[i] >> shift | (shift != 0 ? a[i + 1] << (64 - shift) : 0);
+				}
+				::concrete::detail::big::trim(quotient);
+				::concrete::detail::big::trim(remainder);
+			}
+
+			inline limbs reciprocal(const limbs& x, ::std::size_t precision) {
+				::std::size_t m{x.size() < precision + 2 ? x.size() : precision + 2};
+				limbs top(x.end() - m, x.end());
+				if (precision <= newton_threshold) {
+					limbs power(m + precision + 1), quotient, remainder;
+					power.back() = 1;
+					::concrete::detail::big::schoolbook_divide(power, top, quotient, remainder);
+					return quotient;
+				}
+				::std::size_t half{(precision >> 1) + 1};
+				limbs y{::concrete::detail::big::reciprocal(top, half)};
+				limbs power(m + half + 1);
+				power.back() = 1;
+				limbs t{::concrete::detail::big::multiply(top, y)};
+				limbs res{::concrete::detail::big::shift_limbs(y, precision - half)};
+				::std::ptrdiff_t shift{(::std::ptrdiff_t)(m + (half << 1)) - (::std::ptrdiff_t)precision};
+				if (::concrete::detail::big::compare(t, power) <= 0) {
+					limbs e{::concrete::detail::big::shift_limbs(::concrete::detail::big::multiply(y, ::concrete::detail::big::subtract(power, t)), -shift)};
+					return ::concrete::detail::big::add(res, e);
+				}
+				limbs e{::concrete::detail::big::shift_limbs(::concrete::detail::big::multiply(y, ::concrete::detail::big::subtract(t, power)), -shift)};
+				e = ::concrete::detail::big::add(e, limbs{1});
+				return ::concrete::detail::big::compare(res, e) > 0 ? ::concrete::detail::big::subtract(res, e) : limbs{};
+			}
+
+			inline void divide(const limbs& x, const limbs& y, limbs& quotient, limbs& remainder) {
+				if (::concrete::detail::big::compare(x, y) < 0) {
+					quotient.clear();
+					remainder = x;
+					return;
+				}
+				::std::size_t n{x.size()}, m{y.size()};
+				if (m < newton_threshold || n - m < newton_threshold) {
+					::concrete::detail::big::schoolbook_divide(x, y, quotient, remainder);
+					return;
+				}
+				::std::size_t precision{n - m + 1};
+				limbs r{::concrete::detail::big::reciprocal(y, precision)};
+				quotient = ::concrete::detail::big::shift_limbs(::concrete::detail::big::multiply(x, r), -(::std::ptrdiff_t)(m + precision));
+				::concrete::detail::big::trim(quotient);
+				limbs t{::concrete::detail::big::multiply(quotient, y)};
+				while (::concrete::detail::big::compare(t, x) > 0) {
+					quotient = ::concrete::detail::big::subtract(quotient, limbs{1});
+					t = ::concrete::detail::big::subtract(t, y);
+				}
+				remainder = ::concrete::detail::big::subtract(x, t);
+				while (::concrete::detail::big::compare(remainder, y) >= 0) {
+					quotient = ::concrete::detail::big::add(quotient, limbs{1});
+					remainder = ::concrete::detail::big::subtract(remainder, y);
+				}
+			}
+
+			inline const limbs& decimal_power(::std::size_t level) {
+				thread_local ::std::vector<limbs> cache{limbs{decimal_base}};
+				while (cache.size() <= level) {
+					cache.push_back(::concrete::detail::big::multiply(cache.back(), cache.back()));
+				}
+				return cache[level];
+			}
+
+			inline void to_chars(limbs x, ::std::size_t width, ::std::string& out) {
+				if (x.size() > conversion_threshold) {
+					::std::size_t level{0};
+					while (::concrete::detail::big::decimal_power(level + 1).size() <= x.size()) {
+						++level;
+					}
+					if (::concrete::detail::big::compare(::concrete::detail::big::decimal_power(level), x) > 0) {
+						--level;
+					}
+					limbs quotient, remainder;
+					::concrete::detail::big::divide(x, ::concrete::detail::big::decimal_power(level), quotient, remainder);
+					::std::size_t low{decimal_digits << level};
+					::concrete::detail::big::to_chars(::std::move(quotient), width > low ? width - low : 0, out);
+					::concrete::detail::big::to_chars(::std::move(remainder), low, out);
+					return;
+				}
+				::std::string digits;
+				while (!x.empty()) {
+					::concrete::uint64_t chunk{::concrete::detail::big::divide_word(x, decimal_base)};
+					for (::std::size_t i{0}; i != decimal_digits && (!x.empty() || chunk != 0); ++i) {
+						digits.push_back((char)('0' + chunk % 10));
+						chunk /= 10;
+					}
+				}
+				if (digits.size() < width) {
+					out.append(width - digits.size(), '0');
+				}
+				out.append(digits.rbegin(), digits.rend());
+			}
+
+			constexpr bool is_decimal(::std::string_view s) noexcept {
+				if (s.empty()) {
+					return false;
+				}
+				for (char c : s) {
+					if (c < '0' || c > '9') {
+						return false;
+					}
+				}
+				return true;
+			}
+
+			inline limbs from_chars(const char* first, ::std::size_t size) {
+				if (size > decimal_digits * conversion_threshold) {
+					::std::size_t level{0};
+					while ((decimal_digits << (level + 1)) < size) {
+						++level;
+					}
+					::std::size_t low{decimal_digits << level};
+					limbs high{::concrete::detail::big::from_chars(first, size - low)};
+					limbs res{::concrete::detail::big::multiply(high, ::concrete::detail::big::decimal_power(level))};
+					return ::concrete::detail::big::add(res, ::concrete::detail::big::from_chars(first + size - low, low));
+				}
+				limbs res;
+				::std::size_t i{0};
+				while (i != size) {
+					::std::size_t count{(size - i) % decimal_digits != 0 ? (size - i) % decimal_digits : decimal_digits};
+					::concrete::uint64_t chunk{0}, scale{1};
+					for (::std::size_t j{0}; j != count; ++j) {
+						chunk = chunk * 10 + (::concrete::uint64_t)(first[i + j] - '0');
+						scale *= 10;
+					}
+					i += count;
+					::concrete::uint64_t carry{::concrete::detail::big::multiply_word(res, scale, chunk)};
+					if (carry != 0) {
+						res.push_back(carry);
+					}
+				}
+				::concrete::detail::big::trim(res);
+				return res;
+			}
+
+		}
+
+	}
+
+	class big_integer {
+		using _limbs = ::concrete::detail::big::limbs;
+
+		bool _negative;
+		_limbs _data;
+
+		big_integer(bool negative, _limbs data) noexcept : _negative{negative}, _data{::std::move(data)} {
+			::concrete::detail::big::trim(_data);
+			if (_data.empty()) {
+				_negative = false;
+			}
+		}
+
+		big_integer& _add(const big_integer& x, bool negative) {
+			if (_negative == negative) {
+				_data = ::concrete::detail::big::add(_data, x._data);
+			}
+			else if (::concrete::detail::big::compare(_data, x._data) >= 0) {
+				_data = ::concrete::detail::big::subtract(_data, x._data);
+			}
+			else {
+				_data = ::concrete::detail::big::subtract(x._data, _data);
+				_negative = negative;
+			}
+			if (_data.empty()) {
+				_negative = false;
+			}
+			return *this;
+		}
+
+		static int _compare(const big_integer& x, const big_integer& y) noexcept {
+			if (x._negative != y._negative) {
+				return x._negative ? -1 : 1;
+			}
+			int res{::concrete::detail::big::compare(x._data, y._data)};
+			return x._negative ? -res : res;
+		}
+
+	public:
+		big_integer() noexcept : _negative{false} {}
+
+		template<class T, ::std::enable_if_t<::concrete::detail::wide::is_builtin_v<T>, int> = 0>
+		big_integer(T x) : _negative{false} {
+			::concrete::uint128_t v{(::concrete::uint128_t)x};
+			if constexpr (::std::numeric_limits<T>::is_signed || ::std::is_same_v<T, ::concrete::int128_t>) {
+				if (x < 0) {
+					_negative = true;
+					v = ~v + 1;
+				}
+			}
+			while (v != 0) {
+				_data.push_back((::concrete::uint64_t)v);
+				v >>= 64;
+			}
+		}
+
+		explicit big_integer(::std::string_view s) : _negative{false} {
+			if (::std::optional<big_integer> x{from_string(s)}; x) {
+				*this = ::std::move(*x);
+			}
+		}
+
+		static ::std::optional<big_integer> from_string(::std::string_view s) {
+			bool negative{!s.empty() && s[0] == '-'};
+			if (!s.empty() && (s[0] == '-' || s[0] == '+')) {
+				s.remove_prefix(1);
+			}
+			if (!::concrete::detail::big::is_decimal(s)) {
+				return ::std::nullopt;
+			}
+			return big_integer{negative, ::concrete::detail::big::from_chars(s.data(), s.size())};
+		}
+
+		::std::string to_string() const {
+			::std::string res{_negative ? "-" : ""};
+			if (_data.empty()) {
+				res.push_back('0');
+			}
+			else {
+				::concrete::detail::big::to_chars(_data, 0, res);
+			}
+			return res;
+		}
+
+		explicit operator bool() const noexcept {
+			return !_data.empty();
+		}
+
+		template<class T, ::std::enable_if_t<::concrete::detail::wide::is_builtin_v<T>, int> = 0>
+		explicit operator T() const noexcept {
+			::concrete::uint128_t v{0};
+			if (_data.size() > 1) {
+				v = (::concrete::uint128_t)_data[1] << 64;
+			}
+			if (!_data.empty()) {
+				v |= _data[0];
+			}
+			return (T)(_negative ? ~v + 1 : v);
+		}
+
+		bool is_negative() const noexcept {
+			return _negative;
+		}
+
+		const ::std::vector<::concrete::uint64_t>& data() const noexcept {
+			return _data;
+		}
+
+		big_integer& operator+=(const big_integer& x) {
+			return _add(x, x._negative);
+		}
+
+		big_integer& operator-=(const big_integer& x) {
+			return _add(x, !x._negative);
+		}
+
+		big_integer& operator*=(const big_integer& x) {
+			return *this = big_integer{_negative != x._negative, ::concrete::detail::big::multiply(_data, x._data)};
+		}
+
+		big_integer& operator/=(const big_integer& x) {
+			_limbs quotient, remainder;
+			::concrete::detail::big::divide(_data, x._data, quotient, remainder);
+			return *this = big_integer{_negative != x._negative, ::std::move(quotient)};
+		}
+
+		big_integer& operator%=(const big_integer& x) {
+			_limbs quotient, remainder;
+			::concrete::detail::big::divide(_data, x._data, quotient, remainder);
+			return *this = big_integer{_negative, ::std::move(remainder)};
+		}
+
+		big_integer& operator<<=(::std::size_t n) {
+			if (_data.empty()) {
+				return *this;
+			}
+			unsigned bit{(unsigned)(n % 64)};
+			_limbs res(_data.size() + n / 64 + 1);
+			for (::std::size_t i{0}; i != _data.size(); ++i) {
+				res[i + n / 64] |= _data[i] << bit;
+				if (bit != 0) {
+					res[i + n / 64 + 1] = _data[i] >> (64 - bit);
+				}
+			}
+			return *this = big_integer{_negative, ::std::move(res)};
+		}
+
+		big_integer& operator>>=(::std::size_t n) {
+			::std::size_t shift{n / 64};
+			unsigned bit{(unsigned)(n % 64)};
+			bool inexact{false};
+			for (::std::size_t i{0}; i != shift && i != _data.size(); ++i) {
+				inexact |= _data[i] != 0;
+			}
+			if (shift < _data.size() && bit != 0) {
+				inexact |= (_data[shift] & (((::concrete::uint64_t)1 << bit) - 1)) != 0;
+			}
+			_limbs res(shift < _data.size() ? _data.size() - shift : 0);
+			for (::std::size_t i{0}; i != res.size(); ++i) {
+				res[i] = _data[i + shift] >> bit;
+				if (bit != 0 && i + shift + 1 < _data.size()) {
+					res[i] |= _data[i + shift + 1] << (64 - bit);
+				}
+			}
+			bool negative{_negative};
+			*this = big_integer{negative, ::std::move(res)};
+			return negative && inexact ? *this -= 1 : *this;
+		}
+
+		big_integer operator+() const {
+			return *this;
+		}
+
+		big_integer operator-() const {
+			return big_integer{!_negative, _data};
+		}
+
+		friend big_integer operator+(big_integer x, const big_integer& y) {
+			return x += y;
+		}
+
+		friend big_integer operator-(big_integer x, const big_integer& y) {
+			return x -= y;
+		}
+
+		friend big_integer operator*(const big_integer& x, const big_integer& y) {
+			return big_integer{x._negative != y._negative, ::concrete::detail::big::multiply(x._data, y._data)};
+		}
+
+		friend big_integer operator/(big_integer x, const big_integer& y) {
+			return x /= y;
+		}
+
+		friend big_integer operator%(big_integer x, const big_integer& y) {
+			return x %= y;
+		}
+
+		friend big_integer operator<<(big_integer x, ::std::size_t n) {
+			return x <<= n;
+		}
+
+		friend big_integer operator>>(big_integer x, ::std::size_t n) {
+			return x >>= n;
+		}
+
+		friend bool operator==(const big_integer& x, const big_integer& y) noexcept {
+			return x._negative == y._negative && x._data == y._data;
+		}
+
+		friend bool operator!=(const big_integer& x, const big_integer& y) noexcept {
+			return !(x == y);
+		}
+
+		friend bool operator<(const big_integer& x, const big_integer& y) noexcept {
+			return _compare(x, y) < 0;
+		}
+
+		friend bool operator>(const big_integer& x, const big_integer& y) noexcept {
+			return _compare(x, y) > 0;
+		}
+
+		friend bool operator<=(const big_integer& x, const big_integer& y) noexcept {
+			return _compare(x, y) <= 0;
+		}
+
+		friend bool operator>=(const big_integer& x, const big_integer& y) noexcept {
+			return _compare(x, y) >= 0;
+		}
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,316 @@
+#pragma once
+
+#include "integral.h"
+#include "standard.h"
+
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace bits {
+
+			constexpr ::std::size_t word_bits{64};
+			constexpr ::std::size_t subblock_words{8};
+			constexpr ::std::size_t block_words{32};
+			constexpr ::std::size_t block_bits{block_words * word_bits};
+			constexpr ::std::size_t superblock_blocks{::std::size_t{1} << 21};
+			constexpr ::std::size_t select_sample{8192};
+
+			inline ::concrete::uint64_t popcount_generic(const ::concrete::uint64_t* data, ::std::size_t size) noexcept {
+				::concrete::uint64_t acc[4]{};
+				::std::size_t i{0};
+				for (; i + 4 <= size; i += 4) {
+					acc[0] += ::concrete::popcount(data[i]);
+					acc[1] += ::concrete::popcount(data[i + 1]);
+					acc[2] += ::concrete::popcount(data[i + 2]);
+					acc[3] += ::concrete::popcount(data[i + 3]);
+				}
+				for (; i < size; ++i) {
+					acc[0] += ::concrete::popcount(data[i]);
+				}
+				return acc[0] + acc[1] + acc[2] + acc[3];
+			}
+
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+			[[gnu::target("popcnt"), gnu::flatten]] inline ::concrete::uint64_t popcount_sse42(const ::concrete::uint64_t* data, ::std::size_t size) noexcept {
+				return ::concrete::detail::bits::popcount_generic(data, size);
+			}
+
+			[[gnu::target("avx2,popcnt")]] inline ::concrete::uint64_t popcount_avx2(const ::concrete::uint64_t* data, ::std::size_t size) noexcept {
+				const __m256i lookup{_mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4)};
+				const __m256i low{_mm256_set1_epi8(0x0f)};
+				const __m256i zero{_mm256_setzero_si256()};
+				__m256i total{zero};
+				::std::size_t i{0};
+				while (i + 4 <= size) {
+					__m256i acc{zero};
+					for (int j{0}; j != 31 && i + 4 <= size; ++j, i += 4) {
+						__m256i v{_mm256_loadu_si256((const __m256i*)(data + i))};
+						__m256i lo{_mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low))};
+						__m256i hi{_mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low))};
+						acc = _mm256_add_epi8(acc, _mm256_add_epi8(lo, hi));
+					}
+					total = _mm256_add_epi64(total, _mm256_sad_epu8(acc, zero));
+				}
+				::concrete::uint64_t res{(::concrete::uint64_t)_mm256_extract_epi64(total, 0) + (::concrete::uint64_t)_mm256_extract_epi64(total, 1)
+					+ (::concrete::uint64_t)_mm256_extract_epi64(total, 2) + (::concrete::uint64_t)_mm256_extract_epi64(total, 3)};
+				for (; i != size; ++i) {
+					res += (::concrete::uint64_t)__builtin_popcountll(data[i]);
+				}
+				return res;
+			}
+
+			[[gnu::target("avx512f,avx512bw,avx2,popcnt")]] inline ::concrete::uint64_t popcount_avx512(const ::concrete::uint64_t* data, ::std::size_t size) noexcept {
+				const __m512i lookup{_mm512_set4_epi32(0x04030302, 0x03020201, 0x03020201, 0x02010100)};
+				const __m512i low{_mm512_set1_epi8(0x0f)};
+				const __m512i zero{_mm512_setzero_si512()};
+				__m512i total{zero};
+				::std::size_t i{0};
+				while (i + 8 <= size) {
+					__m512i acc{zero};
+					for (int j{0}; j != 31 && i + 8 <= size; ++j, i += 8) {
+						__m512i v{_mm512_loadu_si512((const void*)(data + i))};
+						__m512i lo{_mm512_shuffle_epi8(lookup, _mm512_and_si512(v, low))};
+						__m512i hi{_mm512_shuffle_epi8(lookup, _mm512_and_si512(_mm512_srli_epi16(v, 4), low))};
+						acc = _mm512_add_epi8(acc, _mm512_add_epi8(lo, hi));
+					}
+					total = _mm512_add_epi64(total, _mm512_sad_epu8(acc, zero));
+				}
+				alignas(64) ::concrete::uint64_t lanes[8];
+				_mm512_store_si512((void*)lanes, total);
+				::concrete::uint64_t res{lanes[0] + lanes[1] + lanes[2] + lanes[3] + lanes[4] + lanes[5] + lanes[6] + lanes[7]};
+				for (; i != size; ++i) {
+					res += (::concrete::uint64_t)__builtin_popcountll(data[i]);
+				}
+				return res;
+			}
+#endif
+
+			inline const auto& popcount_dispatch() {
+				static const ::concrete::dispatch<::concrete::uint64_t(const ::concrete::uint64_t*, ::std::size_t)> res{
+					{::concrete::isa::generic, &::concrete::detail::bits::popcount_generic},
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+					{::concrete::isa::sse42, &::concrete::detail::bits::popcount_sse42},
+					{::concrete::isa::avx2, &::concrete::detail::bits::popcount_avx2},
+					{::concrete::isa::avx512, &::concrete::detail::bits::popcount_avx512},
+#endif
+				};
+				return res;
+			}
+
+			constexpr int select(::concrete::uint64_t x, int k) noexcept {
+				constexpr ::concrete::uint64_t ones{0x0101010101010101ull}, highs{0x8080808080808080ull};
+				::concrete::uint64_t s{x - (x >> 1 & 0x5555555555555555ull)};
+				s = (s & 0x3333333333333333ull) + (s >> 2 & 0x3333333333333333ull);
+				s = ((s + (s >> 4)) & 0x0f0f0f0f0f0f0f0full) * ones;
+				::concrete::uint64_t geq{(((::concrete::uint64_t)k * ones | highs) - s) & highs};
+				int place{(int)((geq >> 7) * ones >> 56) * 8};
+				int rank{k - (int)((s << 8) >> place & 0xff)};
+				::concrete::uint64_t byte{x >> place & 0xff};
+				for (; rank != 0; --rank) {
+					byte &= byte - 1;
+				}
+				return place + ::concrete::countr_zero(byte);
+			}
+
+		}
+
+	}
+
+	inline ::concrete::uint64_t popcount(const ::concrete::uint64_t* data, ::std::size_t size) {
+		return ::concrete::detail::bits::popcount_dispatch()(data, size);
+	}
+
+	class bit_vector {
+		::std::size_t _size;
+		::concrete::uint64_t _count;
+		::std::vector<::concrete::uint64_t> _data, _blocks, _superblocks;
+		::std::vector<::concrete::uint32_t> _samples[2];
+
+		::concrete::uint64_t _rank_before(::std::size_t block) const noexcept {
+			using namespace ::concrete::detail::bits;
+			return _superblocks[block / superblock_blocks] + (::concrete::uint32_t)_blocks[block];
+		}
+
+		template<bool bit>
+		::concrete::uint64_t _count_before(::std::size_t block) const noexcept {
+			using namespace ::concrete::detail::bits;
+			::concrete::uint64_t ones{_rank_before(block)};
+			return bit ? ones : block * block_bits - ones;
+		}
+
+		void _build() {
+			using namespace ::concrete::detail::bits;
+			::std::size_t words{(_size + word_bits - 1) / word_bits};
+			::std::size_t blocks{(words + block_words - 1) / block_words};
+			_data.resize(blocks * block_words);
+			if (_size % word_bits != 0) {
+				_data[_size / word_bits] &= (::concrete::uint64_t{1} << _size % word_bits) - 1;
+			}
+			_blocks.assign(blocks + 1, 0);
+			_superblocks.assign(blocks / superblock_blocks + 1, 0);
+			::concrete::uint64_t total{0};
+			for (::std::size_t b{0}; b <= blocks; ++b) {
+				if (b % superblock_blocks == 0) {
+					_superblocks[b / superblock_blocks] = total;
+				}
+				::concrete::uint64_t entry{total - _superblocks[b / superblock_blocks]};
+				if (b != blocks) {
+					for (::std::size_t s{0}; s != block_words / subblock_words; ++s) {
+						::concrete::uint64_t count{::concrete::detail::bits::popcount_generic(_data.data() + b * block_words + s * subblock_words, subblock_words)};
+						if (s != block_words / subblock_words - 1) {
+							entry |= count << (32 + 10 * s);
+						}
+						total += count;
+					}
+				}
+				_blocks[b] = entry;
+			}
+			_count = total;
+			_data.shrink_to_fit();
+			_build_samples<false>(blocks);
+			_build_samples<true>(blocks);
+		}
+
+		template<bool bit>
+		void _build_samples(::std::size_t blocks) {
+			using namespace ::concrete::detail::bits;
+			::std::vector<::concrete::uint32_t>& samples{_samples[bit]};
+			samples.clear();
+			::concrete::uint64_t next{0};
+			for (::std::size_t b{0}; b != blocks; ++b) {
+				::concrete::uint64_t end{_count_before<bit>(b + 1)};
+				for (; next < end; next += select_sample) {
+					samples.push_back((::concrete::uint32_t)b);
+				}
+			}
+			samples.push_back((::concrete::uint32_t)(blocks == 0 ? 0 : blocks - 1));
+			samples.shrink_to_fit();
+		}
+
+		template<bool bit>
+		::std::size_t _select(::concrete::uint64_t k) const noexcept {
+			using namespace ::concrete::detail::bits;
+			if (k >= (bit ? _count : _size - _count)) {
+				return _size;
+			}
+			const ::std::vector<::concrete::uint32_t>& samples{_samples[bit]};
+			::std::size_t j{(::std::size_t)(k / select_sample)};
+			::std::size_t lo{samples[j]}, hi{(::std::size_t)samples[j + 1] + 1};
+			while (hi - lo > 1) {
+				::std::size_t mid{lo + (hi - lo) / 2};
+				if (_count_before<bit>(mid) <= k) {
+					lo = mid;
+				}
+				else {
+					hi = mid;
+				}
+			}
+			k -= _count_before<bit>(lo);
+			::concrete::uint64_t entry{_blocks[lo]};
+			::std::size_t w{lo * block_words};
+			for (int s{0}; s != 3; ++s, w += subblock_words) {
+				::concrete::uint64_t count{entry >> (32 + 10 * s) & 1023};
+				count = bit ? count : subblock_words * word_bits - count;
+				if (k < count) {
+					break;
+				}
+				k -= count;
+			}
+			while (true) {
+				::concrete::uint64_t x{bit ? _data[w] : ~_data[w]};
+				::concrete::uint64_t count{(::concrete::uint64_t)::concrete::popcount(x)};
+				if (k < count) {
+					return w * word_bits + ::concrete::detail::bits::select(x, (int)k);
+				}
+				k -= count;
+				++w;
+			}
+		}
+
+	public:
+		explicit bit_vector(::std::size_t size) : bit_vector(::std::vector<::concrete::uint64_t>{}, size) {}
+
+		explicit bit_vector(::std::vector<::concrete::uint64_t> words, ::std::size_t size) :
+			_size{size},
+			_count{0},
+			_data(::std::move(words)) {
+			_data.resize((size + ::concrete::detail::bits::word_bits - 1) / ::concrete::detail::bits::word_bits);
+			_build();
+		}
+
+		template<class input_iterator>
+		explicit bit_vector(input_iterator first, input_iterator last) : _size{0}, _count{0} {
+			for (; first != last; ++first, ++_size) {
+				if (_size % ::concrete::detail::bits::word_bits == 0) {
+					_data.push_back(0);
+				}
+				if (*first) {
+					_data.back() |= ::concrete::uint64_t{1} << _size % ::concrete::detail::bits::word_bits;
+				}
+			}
+			_build();
+		}
+
+		::std::size_t size() const noexcept {
+			return _size;
+		}
+
+		::concrete::uint64_t count() const noexcept {
+			return _count;
+		}
+
+		const ::concrete::uint64_t* data() const noexcept {
+			return _data.data();
+		}
+
+		bool operator[](::std::size_t index) const noexcept {
+			return _data[index / ::concrete::detail::bits::word_bits] >> index % ::concrete::detail::bits::word_bits & 1;
+		}
+
+		::concrete::uint64_t rank1(::std::size_t index) const noexcept {
+			using namespace ::concrete::detail::bits;
+			::std::size_t b{index / block_bits};
+			::concrete::uint64_t entry{_blocks[b]};
+			::concrete::uint64_t res{_superblocks[b / superblock_blocks] + (::concrete::uint32_t)entry};
+			::std::size_t s{index / (subblock_words * word_bits) % (block_words / subblock_words)};
+			for (::std::size_t t{0}; t != s; ++t) {
+				res += entry >> (32 + 10 * t) & 1023;
+			}
+			::std::size_t w{b * block_words + s * subblock_words}, end{index / word_bits};
+			for (; w != end; ++w) {
+				res += (::concrete::uint64_t)::concrete::popcount(_data[w]);
+			}
+			if (index % word_bits != 0) {
+				res += (::concrete::uint64_t)::concrete::popcount(_data[end] & ((::concrete::uint64_t{1} << index % word_bits) - 1));
+			}
+			return res;
+		}
+
+		::concrete::uint64_t rank0(::std::size_t index) const noexcept {
+			return index - rank1(index);
+		}
+
+		::std::size_t select1(::concrete::uint64_t k) const noexcept {
+			return _select<true>(k);
+		}
+
+		::std::size_t select0(::concrete::uint64_t k) const noexcept {
+			return _select<false>(k);
+		}
+
+		::std::size_t space_overhead() const noexcept {
+			return (_blocks.size() + _superblocks.size()) * sizeof(::concrete::uint64_t)
+				+ (_samples[0].size() + _samples[1].size()) * sizeof(::concrete::uint32_t);
+		}
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "big_integer.h"
+#include <random>
+
+static concrete::big_integer random_big_integer(std::size_t digits) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::string s(digits, '0');
+	s[0] = (char)('1' + eng() % 9);
+	for (std::size_t i{1}; i != digits; ++i) {
+		s[i] = (char)('0' + eng() % 10);
+	}
+	return concrete::big_integer{s};
+}
+
+static void BM_multiply(benchmark::State& state) {
+	auto x{random_big_integer(state.range(0))}, y{random_big_integer(state.range(0))};
+	for (auto _ : state) {
+		auto z{x * y};
+		benchmark::DoNotOptimize(z.data().data());
+	}
+}
+
+static void BM_divide(benchmark::State& state) {
+	auto x{random_big_integer(state.range(0) << 1)}, y{random_big_integer(state.range(0))};
+	for (auto _ : state) {
+		auto z{x / y};
+		benchmark::DoNotOptimize(z.data().data());
+	}
+}
+
+static void BM_to_string(benchmark::State& state) {
+	auto x{random_big_integer(state.range(0))};
+	for (auto _ : state) {
+		auto s{x.to_string()};
+		benchmark::DoNotOptimize(s.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_from_string(benchmark::State& state) {
+	auto s{random_big_integer(state.range(0)).to_string()};
+	for (auto _ : state) {
+		concrete::big_integer x{s};
+		benchmark::DoNotOptimize(x.data().data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_factorial(benchmark::State& state) {
+	for (auto _ : state) {
+		std::vector<concrete::big_integer> terms;
+		for (int64_t i{1}; i <= state.range(0); ++i) {
+			terms.emplace_back(i);
+		}
+		while (terms.size() > 1) {
+			std::vector<concrete::big_integer> next;
+			for (std::size_t i{0}; i + 1 < terms.size(); i += 2) {
+				next.push_back(terms[i] * terms[i + 1]);
+			}
+			if (terms.size() % 2 != 0) {
+				next.push_back(terms.back());
+			}
+			terms.swap(next);
+		}
+		benchmark::DoNotOptimize(terms[0].data().data());
+	}
+}
+
+BENCHMARK(BM_multiply)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_divide)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_to_string)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_from_string)->RangeMultiplier(10)->Range(100, 1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_factorial)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
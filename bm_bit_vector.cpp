@@ -0,0 +1,82 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "bit_vector.h"
+#include <random>
+
+static std::vector<concrete::uint64_t> random_words(std::size_t size) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<concrete::uint64_t> res(size);
+	for (auto& x : res) {
+		x = eng();
+	}
+	return res;
+}
+
+static void BM_popcount_scalar(benchmark::State& state) {
+	auto words{random_words(state.range(0))};
+	for (auto _ : state) {
+		concrete::uint64_t res{0};
+		for (concrete::uint64_t x : words) {
+			res += concrete::popcount(x);
+		}
+		benchmark::DoNotOptimize(res);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(concrete::uint64_t));
+}
+
+static void BM_popcount_bulk(benchmark::State& state) {
+	auto words{random_words(state.range(0))};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(concrete::popcount(words.data(), words.size()));
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(concrete::uint64_t));
+	state.SetLabel(std::to_string((int)concrete::detail::bits::popcount_dispatch().selected()));
+}
+
+static void BM_rank(benchmark::State& state) {
+	std::size_t size{(std::size_t)state.range(0) * 64};
+	concrete::bit_vector v{random_words(state.range(0)), size};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<std::size_t> queries(1 << 16);
+	for (auto& q : queries) {
+		q = eng() % (size + 1);
+	}
+	std::size_t i{0};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(v.rank1(queries[i++ & (queries.size() - 1)]));
+	}
+}
+
+static void BM_select(benchmark::State& state) {
+	std::size_t size{(std::size_t)state.range(0) * 64};
+	concrete::bit_vector v{random_words(state.range(0)), size};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<concrete::uint64_t> queries(1 << 16);
+	for (auto& q : queries) {
+		q = eng() % v.count();
+	}
+	std::size_t i{0};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(v.select1(queries[i++ & (queries.size() - 1)]));
+	}
+}
+
+static void BM_build(benchmark::State& state) {
+	std::size_t size{(std::size_t)state.range(0) * 64};
+	auto words{random_words(state.range(0))};
+	for (auto _ : state) {
+		concrete::bit_vector v{words, size};
+		benchmark::DoNotOptimize(v.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(concrete::uint64_t));
+}
+
+BENCHMARK(BM_popcount_scalar)->RangeMultiplier(8)->Range(1 << 9, 1 << 21);
+BENCHMARK(BM_popcount_bulk)->RangeMultiplier(8)->Range(1 << 9, 1 << 21);
+BENCHMARK(BM_rank)->RangeMultiplier(8)->Range(1 << 9, 1 << 24);
+BENCHMARK(BM_select)->RangeMultiplier(8)->Range(1 << 9, 1 << 24);
+BENCHMARK(BM_build)->RangeMultiplier(8)->Range(1 << 9, 1 << 21);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,45 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "convolution.h"
+#include <random>
+
+using ntt_mint = concrete::int_m<998244353u>;
+using mint = concrete::int_m<1000000007u>;
+
+template<class T>
+static std::vector<T> random_vector(std::size_t n) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<T> res(n);
+	for (auto& x : res) {
+		x = T{(uint32_t)eng()};
+	}
+	return res;
+}
+
+template<class T>
+static void BM_convolution(benchmark::State& state) {
+	auto x{random_vector<T>(state.range(0))}, y{random_vector<T>(state.range(0))};
+	for (auto _ : state) {
+		auto z{concrete::convolution(x, y)};
+		benchmark::DoNotOptimize(z.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class T>
+static void BM_convolution_naive(benchmark::State& state) {
+	auto x{random_vector<T>(state.range(0))}, y{random_vector<T>(state.range(0))};
+	for (auto _ : state) {
+		auto z{concrete::detail::naive_convolution(x, y)};
+		benchmark::DoNotOptimize(z.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_convolution, ntt_mint)->RangeMultiplier(8)->Range(1 << 6, 1 << 21)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_convolution, mint)->RangeMultiplier(8)->Range(1 << 6, 1 << 21)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(BM_convolution_naive, mint)->RangeMultiplier(8)->Range(1 << 6, 1 << 12)->Unit(benchmark::kMicrosecond);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
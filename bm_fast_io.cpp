@@ -0,0 +1,130 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "fast_io.h"
+#include <cinttypes>
+#include <random>
+#include <sstream>
+
+static std::vector<concrete::uint64_t> random_values(std::size_t size) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<concrete::uint64_t> res(size);
+	for (auto& x : res) {
+		x = eng() >> (eng() % 64);
+	}
+	return res;
+}
+
+static std::FILE* random_file(std::size_t size) {
+	std::FILE* file{std::tmpfile()};
+	{
+		concrete::output out{file};
+		for (concrete::uint64_t x : random_values(size)) {
+			out << x << ' ';
+		}
+	}
+	return file;
+}
+
+static void BM_read_fast_io(benchmark::State& state) {
+	std::FILE* file{random_file(state.range(0))};
+	for (auto _ : state) {
+		std::rewind(file);
+		concrete::input in{file};
+		concrete::uint64_t res{0};
+		for (std::int64_t i{0}; i != state.range(0); ++i) {
+			res += in.read<concrete::uint64_t>();
+		}
+		benchmark::DoNotOptimize(res);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	std::fclose(file);
+}
+
+static void BM_read_scanf(benchmark::State& state) {
+	std::FILE* file{random_file(state.range(0))};
+	for (auto _ : state) {
+		std::rewind(file);
+		concrete::uint64_t res{0};
+		for (std::int64_t i{0}; i != state.range(0); ++i) {
+			std::uint64_t x{};
+			if (std::fscanf(file, "%" SCNu64, &x) == 1) {
+				res += x;
+			}
+		}
+		benchmark::DoNotOptimize(res);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	std::fclose(file);
+}
+
+static void BM_read_iostream(benchmark::State& state) {
+	std::ostringstream text;
+	for (concrete::uint64_t x : random_values(state.range(0))) {
+		text << x << ' ';
+	}
+	std::string s{text.str()};
+	for (auto _ : state) {
+		std::istringstream in{s};
+		concrete::uint64_t res{0};
+		for (std::int64_t i{0}; i != state.range(0); ++i) {
+			std::uint64_t x{};
+			in >> x;
+			res += x;
+		}
+		benchmark::DoNotOptimize(res);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_write_fast_io(benchmark::State& state) {
+	auto values{random_values(state.range(0))};
+	std::FILE* file{std::tmpfile()};
+	for (auto _ : state) {
+		std::rewind(file);
+		concrete::output out{file};
+		for (concrete::uint64_t x : values) {
+			out << x << ' ';
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	std::fclose(file);
+}
+
+static void BM_write_printf(benchmark::State& state) {
+	auto values{random_values(state.range(0))};
+	std::FILE* file{std::tmpfile()};
+	for (auto _ : state) {
+		std::rewind(file);
+		for (concrete::uint64_t x : values) {
+			std::fprintf(file, "%" PRIu64 " ", (std::uint64_t)x);
+		}
+		std::fflush(file);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	std::fclose(file);
+}
+
+static void BM_write_fast_io_u128(benchmark::State& state) {
+	auto values{random_values(state.range(0) * 2)};
+	std::FILE* file{std::tmpfile()};
+	for (auto _ : state) {
+		std::rewind(file);
+		concrete::output out{file};
+		for (std::size_t i{0}; i != values.size(); i += 2) {
+			out << ((concrete::uint128_t)values[i] << 64 | values[i + 1]) << ' ';
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	std::fclose(file);
+}
+
+BENCHMARK(BM_read_fast_io)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_read_scanf)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_read_iostream)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_write_fast_io)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_write_printf)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_write_fast_io_u128)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,179 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "fenwick_tree.h"
+#include "perf_counter.h"
+#include <filesystem>
+#include <memory_resource>
+#include <mutex>
+#include <random>
+
+constexpr std::size_t N{1 << 20};
+
+struct fenwick_tree_mutex {
+	concrete::fenwick_tree<uint64_t> tree{N};
+	std::mutex mutex;
+
+	void apply(std::size_t index, uint64_t value) {
+		std::lock_guard lock{mutex};
+		tree.apply(index, value);
+	}
+
+	uint64_t operator[](std::size_t index) {
+		std::lock_guard lock{mutex};
+		return tree[index];
+	}
+};
+
+static fenwick_tree_mutex tree_mutex;
+static concrete::fenwick_tree_atomic<uint64_t> tree_atomic{N};
+static concrete::fenwick_tree_sharded<uint64_t> tree_sharded{N};
+
+template<class Tree>
+static void BM_apply(benchmark::State& state, Tree& tree) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> dist{0, N - 1};
+	for (auto _ : state) {
+		tree.apply(dist(eng), 1);
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<class Tree>
+static void BM_mixed(benchmark::State& state, Tree& tree) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> dist{0, N - 1};
+	bool reader{state.thread_index() == 0};
+	for (auto _ : state) {
+		if (reader) {
+			auto res{tree[dist(eng)]};
+			benchmark::DoNotOptimize(res);
+		}
+		else {
+			tree.apply(dist(eng), 1);
+		}
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+static std::vector<uint64_t> random_indices(std::size_t size, std::size_t count) {
+	std::mt19937_64 eng{1};
+	std::vector<uint64_t> res(count);
+	for (auto& x : res) {
+		x = eng() % size;
+	}
+	return res;
+}
+
+static void BM_build(benchmark::State& state) {
+	std::vector<uint64_t> values(state.range(0), 1);
+	for (auto _ : state) {
+		concrete::fenwick_tree<uint64_t> tree{values.begin(), values.end()};
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(uint64_t));
+}
+
+static void BM_build_diff_many(benchmark::State& state) {
+	std::vector<uint64_t> values(state.range(0), 1);
+	std::vector<concrete::fenwick_tree_diff<uint64_t>> trees;
+	trees.reserve(64);
+	for (auto _ : state) {
+		for (int i{0}; i != 64; ++i) {
+			trees.emplace_back(values.begin(), values.end());
+		}
+		benchmark::DoNotOptimize(trees.data());
+		trees.clear();
+	}
+	state.SetItemsProcessed(state.iterations() * 64);
+}
+
+static void BM_build_diff_many_arena(benchmark::State& state) {
+	std::vector<uint64_t> values(state.range(0), 1);
+	std::vector<std::byte> buffer(64 * state.range(0) * sizeof(uint64_t));
+	std::vector<concrete::pmr::fenwick_tree_diff<uint64_t>> trees;
+	trees.reserve(64);
+	for (auto _ : state) {
+		std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+		for (int i{0}; i != 64; ++i) {
+			trees.emplace_back(values.begin(), values.end(), &arena);
+		}
+		benchmark::DoNotOptimize(trees.data());
+		trees.clear();
+	}
+	state.SetItemsProcessed(state.iterations() * 64);
+}
+
+static std::string mapped_path() {
+	return (std::filesystem::temp_directory_path() / "bm_fenwick_tree.fenwick").string();
+}
+
+static void BM_mapped_build(benchmark::State& state) {
+	std::vector<uint64_t> values(state.range(0), 1);
+	std::string path{mapped_path()};
+	for (auto _ : state) {
+		concrete::fenwick_tree_mapped<uint64_t> tree{path.c_str(), values.begin(), values.end()};
+		benchmark::DoNotOptimize(tree[state.range(0) - 1]);
+	}
+	std::filesystem::remove(path);
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(uint64_t));
+}
+
+static void BM_mapped_open(benchmark::State& state) {
+	std::vector<uint64_t> values(state.range(0), 1);
+	std::string path{mapped_path()};
+	concrete::fenwick_tree_mapped<uint64_t>{path.c_str(), values.begin(), values.end()}.checkpoint();
+	auto indices{random_indices(state.range(0), 1 << 16)};
+	std::size_t i{0};
+	for (auto _ : state) {
+		concrete::fenwick_tree_mapped<uint64_t> tree{path.c_str()};
+		benchmark::DoNotOptimize(tree[indices[i++ & ((1 << 16) - 1)]]);
+	}
+	std::filesystem::remove(path);
+	state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_point_apply(benchmark::State& state) {
+	concrete::fenwick_tree<uint64_t> tree(state.range(0));
+	auto indices{random_indices(state.range(0), 1 << 16)};
+	std::size_t i{0};
+	concrete::perf_counters counters;
+	counters.start();
+	for (auto _ : state) {
+		tree.apply(indices[i++ & ((1 << 16) - 1)], 1);
+	}
+	counters.stop();
+	state.SetItemsProcessed(state.iterations());
+	concrete::set_perf_counters(state, counters, (double)state.iterations());
+}
+
+static void BM_prefix_query(benchmark::State& state) {
+	concrete::fenwick_tree<uint64_t> tree(state.range(0));
+	auto indices{random_indices(state.range(0), 1 << 16)};
+	std::size_t i{0};
+	concrete::perf_counters counters;
+	counters.start();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(tree[indices[i++ & ((1 << 16) - 1)]]);
+	}
+	counters.stop();
+	state.SetItemsProcessed(state.iterations());
+	concrete::set_perf_counters(state, counters, (double)state.iterations());
+}
+
+BENCHMARK(BM_build)->RangeMultiplier(8)->Range(1 << 9, 1 << 24);
+BENCHMARK(BM_build_diff_many)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+BENCHMARK(BM_build_diff_many_arena)->RangeMultiplier(8)->Range(1 << 6, 1 << 15);
+BENCHMARK(BM_mapped_build)->RangeMultiplier(8)->Range(1 << 9, 1 << 24);
+BENCHMARK(BM_mapped_open)->RangeMultiplier(8)->Range(1 << 9, 1 << 24);
+BENCHMARK(BM_point_apply)->RangeMultiplier(8)->Range(1 << 9, 1 << 24);
+BENCHMARK(BM_prefix_query)->RangeMultiplier(8)->Range(1 << 9, 1 << 24);
+BENCHMARK_CAPTURE(BM_apply, mutex, tree_mutex)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_CAPTURE(BM_apply, atomic, tree_atomic)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_CAPTURE(BM_apply, sharded, tree_sharded)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_CAPTURE(BM_mixed, mutex, tree_mutex)->ThreadRange(2, 64)->UseRealTime();
+BENCHMARK_CAPTURE(BM_mixed, atomic, tree_atomic)->ThreadRange(2, 64)->UseRealTime();
+BENCHMARK_CAPTURE(BM_mixed, sharded, tree_sharded)->ThreadRange(2, 64)->UseRealTime();
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,94 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "hash_map.h"
+#include "random.h"
+#include <unordered_map>
+#include <vector>
+
+using flat_map = concrete::flat_hash_map<concrete::uint64_t, concrete::uint64_t>;
+using std_map = std::unordered_map<concrete::uint64_t, concrete::uint64_t>;
+
+static std::vector<concrete::uint64_t> random_keys(std::size_t n, concrete::uint64_t seed) {
+	concrete::xoshiro256pp eng{seed};
+	std::vector<concrete::uint64_t> res(n);
+	for (auto& x : res) {
+		x = eng();
+	}
+	return res;
+}
+
+template<class Map>
+static void BM_insert(benchmark::State& state) {
+	auto keys{random_keys(state.range(0), 1)};
+	for (auto _ : state) {
+		Map map;
+		for (concrete::uint64_t key : keys) {
+			map[key] = key;
+		}
+		benchmark::DoNotOptimize(map.size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Map>
+static void BM_insert_reserved(benchmark::State& state) {
+	auto keys{random_keys(state.range(0), 1)};
+	for (auto _ : state) {
+		Map map;
+		map.reserve(keys.size());
+		for (concrete::uint64_t key : keys) {
+			map[key] = key;
+		}
+		benchmark::DoNotOptimize(map.size());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<class Map, bool hit>
+static void BM_find(benchmark::State& state) {
+	auto keys{random_keys(state.range(0), 1)};
+	auto queries{random_keys(state.range(0), hit ? 1 : 2)};
+	Map map;
+	map.reserve(keys.size());
+	for (concrete::uint64_t key : keys) {
+		map[key] = key;
+	}
+	std::size_t i{0};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(map.find(queries[i]) != map.end());
+		i = i + 1 == queries.size() ? 0 : i + 1;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<class Map>
+static void BM_erase_insert(benchmark::State& state) {
+	auto keys{random_keys(state.range(0), 1)};
+	Map map;
+	map.reserve(keys.size());
+	for (concrete::uint64_t key : keys) {
+		map[key] = key;
+	}
+	std::size_t i{0};
+	for (auto _ : state) {
+		map.erase(keys[i]);
+		map[keys[i]] = i;
+		i = i + 1 == keys.size() ? 0 : i + 1;
+	}
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_insert, flat_map)->RangeMultiplier(10)->Range(1000000, 100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_insert, std_map)->RangeMultiplier(10)->Range(1000000, 100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_insert_reserved, flat_map)->RangeMultiplier(10)->Range(1000000, 100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_insert_reserved, std_map)->RangeMultiplier(10)->Range(1000000, 100000000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_find, flat_map, true)->RangeMultiplier(10)->Range(1000000, 100000000);
+BENCHMARK_TEMPLATE(BM_find, std_map, true)->RangeMultiplier(10)->Range(1000000, 100000000);
+BENCHMARK_TEMPLATE(BM_find, flat_map, false)->RangeMultiplier(10)->Range(1000000, 100000000);
+BENCHMARK_TEMPLATE(BM_find, std_map, false)->RangeMultiplier(10)->Range(1000000, 100000000);
+BENCHMARK_TEMPLATE(BM_erase_insert, flat_map)->RangeMultiplier(10)->Range(1000000, 100000000);
+BENCHMARK_TEMPLATE(BM_erase_insert, std_map)->RangeMultiplier(10)->Range(1000000, 100000000);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,209 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "int_m.h"
+#include <random>
+
+constexpr std::size_t batch{1024};
+
+constexpr uint32_t m32{998244353u};
+constexpr uint64_t m64{2305843009213693951u};
+constexpr uint64_t m62{4611686018427387847u};
+
+template<class T>
+static std::vector<T> random_values(T m, uint64_t seed) {
+	std::mt19937_64 eng{seed};
+	std::vector<T> res(batch);
+	for (auto& x : res) {
+		x = (T)(eng() % m);
+	}
+	return res;
+}
+
+template<class T>
+static void BM_modular_add(benchmark::State& state, T m) {
+	concrete::modular_arithmetic<T> mod{m};
+	auto x{random_values(m, 1)}, y{random_values(m, 2)};
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			x[i] = mod.add(x[i], y[i]);
+		}
+		benchmark::DoNotOptimize(x.data());
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<class T>
+static void BM_modular_multiply(benchmark::State& state, T m) {
+	concrete::modular_arithmetic<T> mod{m};
+	auto x{random_values(m, 1)}, y{random_values(m, 2)};
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			x[i] = mod.multiply(x[i], y[i]);
+		}
+		benchmark::DoNotOptimize(x.data());
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<class T>
+static void BM_modular_multiply_latency(benchmark::State& state, T m) {
+	concrete::modular_arithmetic<T> mod{m};
+	auto x{random_values(m, 1)};
+	T acc{mod(x[0])};
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			acc = mod.multiply(acc, x[i]);
+		}
+		benchmark::DoNotOptimize(acc);
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<class T>
+static void BM_modular_power(benchmark::State& state, T m) {
+	concrete::modular_arithmetic<T> mod{m};
+	auto x{random_values(m, 1)}, y{random_values(m, 2)};
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			benchmark::DoNotOptimize(mod.power(x[i], y[i]));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<class T>
+static void BM_modular_inverse(benchmark::State& state, T m) {
+	concrete::modular_arithmetic<T> mod{m};
+	auto x{random_values(m, 1)};
+	for (auto& v : x) {
+		v = v == 0 ? 1 : v;
+	}
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			benchmark::DoNotOptimize(mod.inverse(x[i]));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<auto m>
+static void BM_int_m_arithmetic(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	auto values{random_values<decltype(m)>(m, 3)};
+	std::vector<mint> x(values.begin(), values.end()), y(x.rbegin(), x.rend());
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			x[i] = x[i] * y[i] + x[i] - y[i];
+		}
+		benchmark::DoNotOptimize(x.data());
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<auto m>
+static void BM_int_m_dot_product(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	auto values{random_values<decltype(m)>(m, 4)};
+	std::vector<mint> x(values.begin(), values.end()), y(x.rbegin(), x.rend());
+	for (auto _ : state) {
+		mint acc{0};
+		for (std::size_t i{0}; i != batch; ++i) {
+			acc += x[i] * y[i];
+		}
+		benchmark::DoNotOptimize(acc);
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<auto m>
+static void BM_int_m_multiply_latency(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	auto values{random_values<decltype(m)>(m, 1)};
+	std::vector<mint> x(values.begin(), values.end());
+	mint acc{x[0]};
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			acc *= x[i];
+		}
+		benchmark::DoNotOptimize(acc);
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<auto m>
+static void BM_int_m_multiply_constant(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	auto values{random_values<decltype(m)>(m, 6)};
+	std::vector<mint> x(values.begin(), values.end());
+	mint w{values.back()};
+	benchmark::DoNotOptimize(w);
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			x[i] *= w;
+		}
+		benchmark::DoNotOptimize(x.data());
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<auto m>
+static void BM_int_m_multiply_prepared(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	auto values{random_values<decltype(m)>(m, 6)};
+	std::vector<mint> x(values.begin(), values.end());
+	typename mint::constant_type w{concrete::prepare(mint{values.back()})};
+	benchmark::DoNotOptimize(w);
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			x[i] *= w;
+		}
+		benchmark::DoNotOptimize(x.data());
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+template<auto m>
+static void BM_int_m_divide(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	auto values{random_values<decltype(m)>(m, 5)};
+	std::vector<mint> x(values.begin(), values.end()), y(x.rbegin(), x.rend());
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			benchmark::DoNotOptimize(x[i] / (y[i] + 1));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+BENCHMARK_CAPTURE(BM_modular_add, 32, m32);
+BENCHMARK_CAPTURE(BM_modular_add, 64, m64);
+BENCHMARK_CAPTURE(BM_modular_multiply, 32, m32);
+BENCHMARK_CAPTURE(BM_modular_multiply, 64, m64);
+BENCHMARK_CAPTURE(BM_modular_multiply_latency, 32, m32);
+BENCHMARK_CAPTURE(BM_modular_multiply_latency, 64, m64);
+BENCHMARK_CAPTURE(BM_modular_power, 32, m32);
+BENCHMARK_CAPTURE(BM_modular_power, 64, m64);
+BENCHMARK_CAPTURE(BM_modular_inverse, 32, m32);
+BENCHMARK_CAPTURE(BM_modular_inverse, 64, m64);
+BENCHMARK(BM_int_m_arithmetic<m32>);
+BENCHMARK(BM_int_m_arithmetic<m64>);
+BENCHMARK(BM_int_m_arithmetic<m62>);
+BENCHMARK(BM_int_m_dot_product<m32>);
+BENCHMARK(BM_int_m_dot_product<m64>);
+BENCHMARK(BM_int_m_dot_product<m62>);
+BENCHMARK(BM_int_m_multiply_latency<m32>);
+BENCHMARK(BM_int_m_multiply_latency<m64>);
+BENCHMARK(BM_int_m_multiply_latency<m62>);
+BENCHMARK(BM_int_m_multiply_constant<m32>);
+BENCHMARK(BM_int_m_multiply_constant<m64>);
+BENCHMARK(BM_int_m_multiply_constant<m62>);
+BENCHMARK(BM_int_m_multiply_prepared<m32>);
+BENCHMARK(BM_int_m_multiply_prepared<m64>);
+BENCHMARK(BM_int_m_multiply_prepared<m62>);
+BENCHMARK(BM_int_m_divide<m32>);
+BENCHMARK(BM_int_m_divide<m64>);
+BENCHMARK(BM_int_m_divide<m62>);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
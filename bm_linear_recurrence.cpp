@@ -0,0 +1,64 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "linear_recurrence.h"
+#include <random>
+
+using ntt_mint = concrete::int_m<998244353u>;
+using mint = concrete::int_m<1000000007u>;
+
+template<class T>
+static concrete::linear_recurrence<T> random_recurrence(std::size_t k) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<T> terms(k), coefficients(k);
+	for (std::size_t i{0}; i != k; ++i) {
+		terms[i] = T{(uint32_t)eng()};
+		coefficients[i] = T{(uint32_t)eng()};
+	}
+	return concrete::linear_recurrence<T>{terms, coefficients};
+}
+
+template<class T>
+static void BM_nth_term(benchmark::State& state) {
+	auto recurrence{random_recurrence<T>(state.range(0))};
+	std::mt19937_64 eng{std::random_device{}()};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(recurrence(eng() >> 4));
+	}
+}
+
+template<class T>
+static void BM_nth_term_batch(benchmark::State& state) {
+	auto recurrence{random_recurrence<T>(state.range(0))};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<uint64_t> ns(64);
+	for (auto _ : state) {
+		for (auto& n : ns) {
+			n = eng() >> 4;
+		}
+		auto res{recurrence(ns)};
+		benchmark::DoNotOptimize(res.data());
+	}
+	state.SetItemsProcessed(state.iterations() * ns.size());
+}
+
+template<class T>
+static void BM_berlekamp_massey(benchmark::State& state) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<T> terms(state.range(0) << 1);
+	for (auto& x : terms) {
+		x = T{(uint32_t)eng()};
+	}
+	for (auto _ : state) {
+		auto res{concrete::berlekamp_massey(terms)};
+		benchmark::DoNotOptimize(res.data());
+	}
+}
+
+BENCHMARK_TEMPLATE(BM_nth_term, mint)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_nth_term, ntt_mint)->RangeMultiplier(4)->Range(16, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_nth_term_batch, ntt_mint)->RangeMultiplier(4)->Range(16, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_berlekamp_massey, ntt_mint)->RangeMultiplier(4)->Range(16, 4096)->Unit(benchmark::kMillisecond);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,85 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "math.h"
+#include "perf_counter.h"
+#include <random>
+
+constexpr std::size_t batch{1024};
+
+static std::vector<uint64_t> random_values(int bits, bool prime, uint64_t seed) {
+	std::mt19937_64 eng{seed};
+	std::vector<uint64_t> res;
+	while (res.size() != batch) {
+		uint64_t x{bits == 64 ? eng() : eng() & ((uint64_t{1} << bits) - 1)};
+		x |= uint64_t{1} << (bits - 1) | 1;
+		if (!prime || concrete::is_prime(x)) {
+			res.push_back(x);
+		}
+	}
+	return res;
+}
+
+static void BM_is_prime(benchmark::State& state, bool prime) {
+	auto values{random_values((int)state.range(0), prime, 1)};
+	concrete::perf_counters counters;
+	counters.start();
+	for (auto _ : state) {
+		for (uint64_t x : values) {
+			benchmark::DoNotOptimize(concrete::is_prime(x));
+		}
+	}
+	counters.stop();
+	state.SetItemsProcessed(state.iterations() * batch);
+	concrete::set_perf_counters(state, counters, (double)state.iterations() * batch);
+}
+
+static void BM_greatest_common_divisor(benchmark::State& state) {
+	auto x{random_values((int)state.range(0), false, 2)}, y{random_values((int)state.range(0), false, 3)};
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			benchmark::DoNotOptimize(concrete::greatest_common_divisor(x[i], y[i]));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+static void BM_least_common_multiple(benchmark::State& state) {
+	auto x{random_values((int)state.range(0), false, 4)}, y{random_values((int)state.range(0), false, 5)};
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			benchmark::DoNotOptimize(concrete::least_common_multiple(x[i], y[i]));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+static void BM_kronecker_symbol(benchmark::State& state) {
+	auto x{random_values((int)state.range(0), false, 6)}, y{random_values((int)state.range(0), false, 7)};
+	for (auto _ : state) {
+		for (std::size_t i{0}; i != batch; ++i) {
+			benchmark::DoNotOptimize(concrete::kronecker_symbol(x[i], y[i]));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+static void BM_square_root(benchmark::State& state) {
+	auto values{random_values((int)state.range(0), false, 8)};
+	for (auto _ : state) {
+		for (uint64_t x : values) {
+			benchmark::DoNotOptimize(concrete::square_root(x));
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * batch);
+}
+
+BENCHMARK_CAPTURE(BM_is_prime, random, false)->Arg(16)->Arg(32)->Arg(48)->Arg(62)->Arg(63)->Arg(64);
+BENCHMARK_CAPTURE(BM_is_prime, prime, true)->Arg(16)->Arg(32)->Arg(48)->Arg(62)->Arg(63)->Arg(64);
+BENCHMARK(BM_greatest_common_divisor)->DenseRange(16, 64, 16);
+BENCHMARK(BM_least_common_multiple)->DenseRange(16, 32, 16);
+BENCHMARK(BM_kronecker_symbol)->DenseRange(16, 64, 16);
+BENCHMARK(BM_square_root)->DenseRange(16, 64, 16);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,89 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "matrix.h"
+#include <random>
+#include <thread>
+
+using mint = concrete::int_m<998244353u>;
+
+static concrete::matrix<mint> random_matrix(std::size_t n) {
+	std::mt19937_64 eng{std::random_device{}()};
+	concrete::matrix<mint> res(n, n);
+	for (std::size_t i{0}; i != n; ++i) {
+		for (std::size_t j{0}; j != n; ++j) {
+			res[i][j] = mint{(uint32_t)eng()};
+		}
+	}
+	return res;
+}
+
+static void set_gops(benchmark::State& state, double ops) {
+	state.counters["GOPS"] = benchmark::Counter(1e-9 * ops, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+static void BM_multiply_naive(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)}, y{random_matrix(n)};
+	for (auto _ : state) {
+		concrete::matrix<mint> z(n, n);
+		for (std::size_t i{0}; i != n; ++i) {
+			for (std::size_t k{0}; k != n; ++k) {
+				mint t{x[i][k]};
+				for (std::size_t j{0}; j != n; ++j) {
+					z[i][j] += t * y[k][j];
+				}
+			}
+		}
+		benchmark::DoNotOptimize(z.data());
+	}
+	set_gops(state, 2.0 * n * n * n);
+}
+
+static void BM_multiply_tiled(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)}, y{random_matrix(n)};
+	for (auto _ : state) {
+		auto z{concrete::matrix_multiply(x, y)};
+		benchmark::DoNotOptimize(z.data());
+	}
+	set_gops(state, 2.0 * n * n * n);
+}
+
+static void BM_multiply_threaded(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)}, y{random_matrix(n)};
+	for (auto _ : state) {
+		auto z{concrete::matrix_multiply(x, y, std::thread::hardware_concurrency())};
+		benchmark::DoNotOptimize(z.data());
+	}
+	set_gops(state, 2.0 * n * n * n);
+}
+
+static void BM_determinant(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(concrete::determinant(x));
+	}
+	set_gops(state, 2.0 * n * n * n / 3);
+}
+
+static void BM_inverse(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)};
+	for (auto _ : state) {
+		auto z{concrete::inverse(x)};
+		benchmark::DoNotOptimize(z);
+	}
+	set_gops(state, 2.0 * n * n * n);
+}
+
+BENCHMARK(BM_multiply_naive)->RangeMultiplier(2)->Range(128, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_multiply_tiled)->RangeMultiplier(2)->Range(128, 2048)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_multiply_threaded)->RangeMultiplier(2)->Range(128, 4096)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_determinant)->RangeMultiplier(2)->Range(128, 4096)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_inverse)->RangeMultiplier(2)->Range(128, 2048)->Unit(benchmark::kMillisecond);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
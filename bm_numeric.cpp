@@ -0,0 +1,100 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "fenwick_tree.h"
+#include "numeric.h"
+#include <numeric>
+#include <random>
+#include <thread>
+
+static std::vector<uint64_t> random_vector(std::size_t n) {
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<uint64_t> res(n);
+	for (auto& x : res) {
+		x = eng();
+	}
+	return res;
+}
+
+static void BM_inclusive_scan_std(benchmark::State& state) {
+	auto a{random_vector(state.range(0))};
+	std::vector<uint64_t> b(a.size());
+	for (auto _ : state) {
+		std::inclusive_scan(a.begin(), a.end(), b.begin());
+		benchmark::DoNotOptimize(b.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(uint64_t));
+}
+
+static void BM_inclusive_scan_concrete(benchmark::State& state) {
+	auto a{random_vector(state.range(0))};
+	std::vector<uint64_t> b(a.size());
+	for (auto _ : state) {
+		concrete::inclusive_scan(a.begin(), a.end(), b.begin());
+		benchmark::DoNotOptimize(b.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(uint64_t));
+}
+
+static void BM_reduce_std(benchmark::State& state) {
+	auto a{random_vector(state.range(0))};
+	for (auto _ : state) {
+		auto res{std::accumulate(a.begin(), a.end(), uint64_t{0})};
+		benchmark::DoNotOptimize(res);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(uint64_t));
+}
+
+static void BM_reduce_concrete(benchmark::State& state) {
+	auto a{random_vector(state.range(0))};
+	for (auto _ : state) {
+		auto res{concrete::reduce(a.begin(), a.end(), uint64_t{0})};
+		benchmark::DoNotOptimize(res);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(uint64_t));
+}
+
+static void BM_fenwick_tree_build(benchmark::State& state) {
+	auto a{random_vector(state.range(0))};
+	for (auto _ : state) {
+		concrete::fenwick_tree<uint64_t> tree{a.begin(), a.end()};
+		benchmark::DoNotOptimize(tree);
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(uint64_t));
+}
+
+static void BM_for_each_block_pool(benchmark::State& state) {
+	std::size_t count{(std::size_t)state.range(0)};
+	std::vector<uint64_t> sums(count);
+	for (auto _ : state) {
+		concrete::detail::parallel::for_each_block(count, count, [&](std::size_t t, std::size_t first, std::size_t last) { sums[t] += last - first; });
+		benchmark::DoNotOptimize(sums.data());
+	}
+}
+
+static void BM_for_each_block_spawn(benchmark::State& state) {
+	std::size_t count{(std::size_t)state.range(0)};
+	std::vector<uint64_t> sums(count);
+	for (auto _ : state) {
+		std::vector<std::thread> threads;
+		for (std::size_t t{1}; t != count; ++t) {
+			threads.emplace_back([&sums, t] { sums[t] += 1; });
+		}
+		sums[0] += 1;
+		for (std::thread& thread : threads) {
+			thread.join();
+		}
+		benchmark::DoNotOptimize(sums.data());
+	}
+}
+
+BENCHMARK(BM_inclusive_scan_std)->RangeMultiplier(16)->Range(1 << 12, 1 << 26)->UseRealTime();
+BENCHMARK(BM_inclusive_scan_concrete)->RangeMultiplier(16)->Range(1 << 12, 1 << 26)->UseRealTime();
+BENCHMARK(BM_reduce_std)->RangeMultiplier(16)->Range(1 << 12, 1 << 26)->UseRealTime();
+BENCHMARK(BM_reduce_concrete)->RangeMultiplier(16)->Range(1 << 12, 1 << 26)->UseRealTime();
+BENCHMARK(BM_fenwick_tree_build)->RangeMultiplier(16)->Range(1 << 12, 1 << 26)->UseRealTime();
+BENCHMARK(BM_for_each_block_pool)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(BM_for_each_block_spawn)->Arg(2)->Arg(4)->Arg(8)->UseRealTime();
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -2,6 +2,8 @@
 #pragma comment(lib, "shlwapi.lib")
 #include <benchmark/benchmark.h>
 
+#include "matrix.h"
+#include "random.h"
 #include "standard.h"
 #include <random>
 
@@ -90,7 +92,7 @@ constexpr bool test{LR16(3272062159, 3272062159) == 1783393135476470575};
 
 #define BMS(func, scope) \
 static void func##_##scope(benchmark::State& state) { \
-	std::mt19937_64 eng{std::random_device{}()}; \
+	concrete::xoshiro256pp eng{std::random_device{}()}; \
 	std::uniform_int_distribution dist{}; \
 	for (auto _ : state) { \
 		auto res{scope::func(dist(eng), dist(eng))}; \
@@ -108,4 +110,25 @@ BM(LR);
 BM(LR4);
 BM(LR16);
 
+template<std::size_t n>
+static void BM_matrix_power(benchmark::State& state) {
+	using matrix = concrete::static_matrix<concrete::int_m<998244353u>, n>;
+	std::mt19937_64 eng{std::random_device{}()};
+	matrix x;
+	for (std::size_t i{0}; i != n; ++i) {
+		for (std::size_t j{0}; j != n; ++j) {
+			x[i][j] = (uint32_t)eng();
+		}
+	}
+	for (auto _ : state) {
+		auto res{concrete::power(x, eng())};
+		benchmark::DoNotOptimize(res);
+	}
+}
+
+BENCHMARK(BM_matrix_power<2>);
+BENCHMARK(BM_matrix_power<4>);
+BENCHMARK(BM_matrix_power<8>);
+BENCHMARK(BM_matrix_power<16>);
+
 //BENCHMARK_MAIN();
\ No newline at end of file
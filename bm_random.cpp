@@ -0,0 +1,76 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+#include <random>
+#include <vector>
+
+template<class Engine>
+static void BM_next(benchmark::State& state) {
+	Engine eng{std::random_device{}()};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(eng());
+	}
+	state.SetBytesProcessed(state.iterations() * sizeof(typename Engine::result_type));
+}
+
+template<class Engine>
+static void BM_fill(benchmark::State& state) {
+	Engine eng{std::random_device{}()};
+	std::vector<typename Engine::result_type> buffer(state.range(0));
+	for (auto _ : state) {
+		if constexpr (std::is_same_v<Engine, std::mt19937_64>) {
+			for (auto& x : buffer) {
+				x = eng();
+			}
+		}
+		else {
+			eng.fill(buffer.data(), buffer.size());
+		}
+		benchmark::DoNotOptimize(buffer.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(typename Engine::result_type));
+}
+
+template<class Engine>
+static void BM_uniform_int(benchmark::State& state) {
+	Engine eng{std::random_device{}()};
+	concrete::uint64_t bound{(concrete::uint64_t)state.range(0)};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(concrete::uniform_int(eng, bound));
+	}
+}
+
+template<class Engine>
+static void BM_uniform_int_distribution(benchmark::State& state) {
+	Engine eng{std::random_device{}()};
+	std::uniform_int_distribution<concrete::uint64_t> dist{0, (concrete::uint64_t)state.range(0) - 1};
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(dist(eng));
+	}
+}
+
+static void BM_jump(benchmark::State& state) {
+	concrete::xoshiro256pp eng{std::random_device{}()};
+	for (auto _ : state) {
+		eng.jump();
+		benchmark::DoNotOptimize(eng);
+	}
+}
+
+BENCHMARK(BM_next<std::mt19937_64>);
+BENCHMARK(BM_next<concrete::xoshiro256pp>);
+BENCHMARK(BM_next<concrete::wyrand>);
+BENCHMARK(BM_next<concrete::philox4x32>);
+BENCHMARK(BM_fill<std::mt19937_64>)->Arg(1 << 16);
+BENCHMARK(BM_fill<concrete::xoshiro256pp>)->Arg(1 << 16);
+BENCHMARK(BM_fill<concrete::wyrand>)->Arg(1 << 16);
+BENCHMARK(BM_fill<concrete::philox4x32>)->Arg(1 << 16);
+BENCHMARK(BM_uniform_int<concrete::xoshiro256pp>)->Arg(6)->Arg(1000000007);
+BENCHMARK(BM_uniform_int<concrete::philox4x32>)->Arg(6)->Arg(1000000007);
+BENCHMARK(BM_uniform_int_distribution<std::mt19937_64>)->Arg(6)->Arg(1000000007);
+BENCHMARK(BM_uniform_int_distribution<concrete::xoshiro256pp>)->Arg(6)->Arg(1000000007);
+BENCHMARK(BM_jump);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
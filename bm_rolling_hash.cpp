@@ -0,0 +1,74 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "random.h"
+#include "rolling_hash.h"
+#include <random>
+#include <string>
+
+static std::string random_string(std::size_t size) {
+	concrete::xoshiro256pp eng{std::random_device{}()};
+	std::string res(size, 'a');
+	for (char& c : res) {
+		c = (char)('a' + concrete::uniform_int(eng, 26u));
+	}
+	return res;
+}
+
+template<auto m>
+static void BM_build_sequential(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	std::string s{random_string(state.range(0))};
+	mint base{131};
+	for (auto _ : state) {
+		std::vector<mint> prefix(s.size() + 1), power(s.size() + 1);
+		power[0] = 1;
+		for (std::size_t i{0}; i != s.size(); ++i) {
+			prefix[i + 1] = prefix[i] * base + mint{(typename mint::value_type)(unsigned char)s[i]};
+			power[i + 1] = power[i] * base;
+		}
+		benchmark::DoNotOptimize(prefix.data());
+		benchmark::DoNotOptimize(power.data());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template<auto m>
+static void BM_build(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	std::string s{random_string(state.range(0))};
+	for (auto _ : state) {
+		concrete::rolling_hash<mint> h{s, mint{131}};
+		benchmark::DoNotOptimize(h.hash());
+	}
+	state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+template<auto m>
+static void BM_substring(benchmark::State& state) {
+	using mint = concrete::int_m<m>;
+	std::string s{random_string(state.range(0))};
+	concrete::rolling_hash<mint> h{s, mint{131}};
+	concrete::xoshiro256pp eng{std::random_device{}()};
+	std::vector<std::size_t> queries(1 << 12);
+	for (auto& q : queries) {
+		q = concrete::uniform_int(eng, s.size());
+	}
+	std::size_t i{0};
+	for (auto _ : state) {
+		std::size_t first{queries[i++ & (queries.size() - 1)]};
+		benchmark::DoNotOptimize(h(first, s.size()));
+	}
+}
+
+BENCHMARK(BM_build_sequential<2305843009213693951ull>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_build<2305843009213693951ull>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_build_sequential<4611686018427387847ull>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_build<4611686018427387847ull>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_build_sequential<998244353u>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_build<998244353u>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_substring<2305843009213693951ull>)->Arg(1 << 20);
+BENCHMARK(BM_substring<998244353u>)->Arg(1 << 20);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,108 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "fenwick_tree.h"
+#include "segment_tree.h"
+#include "sparse_table.h"
+#include <random>
+
+template<class Tree>
+static void BM_apply(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	Tree tree{n};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> dist{0, n - 1};
+	for (auto _ : state) {
+		tree.apply(dist(eng), 1);
+	}
+	benchmark::ClobberMemory();
+}
+
+static void BM_prefix_fenwick_tree(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	concrete::fenwick_tree<uint64_t> tree{n};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> dist{0, n - 1};
+	for (auto _ : state) {
+		auto res{tree[dist(eng)]};
+		benchmark::DoNotOptimize(res);
+	}
+}
+
+static void BM_prefix_segment_tree(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	concrete::segment_tree<uint64_t> tree{n};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> dist{0, n - 1};
+	for (auto _ : state) {
+		auto res{tree.query(0, dist(eng) + 1)};
+		benchmark::DoNotOptimize(res);
+	}
+}
+
+static void BM_range_add_fenwick_tree_diff(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	concrete::fenwick_tree_diff<uint64_t> tree{n};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> dist{0, n};
+	for (auto _ : state) {
+		std::size_t l{dist(eng)}, r{dist(eng)};
+		tree.apply(l < r ? l : r, l < r ? r : l, 1);
+	}
+	benchmark::ClobberMemory();
+}
+
+static void BM_range_add_lazy_segment_tree(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	concrete::lazy_segment_tree<uint64_t> tree{n};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> dist{0, n};
+	for (auto _ : state) {
+		std::size_t l{dist(eng)}, r{dist(eng)};
+		tree.apply(l < r ? l : r, l < r ? r : l, 1);
+	}
+	benchmark::ClobberMemory();
+}
+
+static void BM_range_max_segment_tree(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	concrete::segment_tree<uint64_t, concrete::maximum<uint64_t>> tree{n};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::uniform_int_distribution<std::size_t> dist{0, n};
+	for (auto _ : state) {
+		std::size_t l{dist(eng)}, r{dist(eng)};
+		auto res{tree.query(l < r ? l : r, l < r ? r : l)};
+		benchmark::DoNotOptimize(res);
+	}
+}
+
+template<class Table>
+static void BM_range_max_static(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	std::mt19937_64 eng{std::random_device{}()};
+	std::vector<uint64_t> values(n);
+	for (auto& x : values) {
+		x = eng();
+	}
+	Table table{values.begin(), values.end()};
+	std::uniform_int_distribution<std::size_t> dist{0, n - 1};
+	for (auto _ : state) {
+		std::size_t l{dist(eng)}, r{dist(eng)};
+		auto res{table.query(l < r ? l : r, (l < r ? r : l) + 1)};
+		benchmark::DoNotOptimize(res);
+	}
+}
+
+BENCHMARK(BM_apply<concrete::fenwick_tree<uint64_t>>)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_apply<concrete::segment_tree<uint64_t>>)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_prefix_fenwick_tree)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_prefix_segment_tree)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_range_add_fenwick_tree_diff)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_range_add_lazy_segment_tree)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_range_max_segment_tree)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_range_max_static<concrete::sparse_table<uint64_t, concrete::maximum<uint64_t>>>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_range_max_static<concrete::block_sparse_table<uint64_t, concrete::maximum<uint64_t>>>)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_range_max_static<concrete::disjoint_sparse_table<uint64_t, concrete::maximum<uint64_t>>>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
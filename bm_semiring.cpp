@@ -0,0 +1,87 @@
+#define BENCHMARK_STATIC_DEFINE
+#pragma comment(lib, "shlwapi.lib")
+#include <benchmark/benchmark.h>
+
+#include "semiring.h"
+#include <random>
+
+using min_plus = concrete::semiring_traits<concrete::minimum<int32_t>, concrete::add<int32_t>>;
+
+static concrete::matrix<int32_t> random_matrix(std::size_t n) {
+	std::mt19937_64 eng{std::random_device{}()};
+	concrete::matrix<int32_t> res(n, n);
+	for (std::size_t i{0}; i != n; ++i) {
+		for (std::size_t j{0}; j != n; ++j) {
+			res[i][j] = eng() % 4 == 0 ? min_plus::zero : (int32_t)(eng() % 1000000);
+		}
+	}
+	return res;
+}
+
+static void set_gops(benchmark::State& state, std::size_t n) {
+	state.counters["GOPS"] = benchmark::Counter(2e-9 * n * n * n, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+static void BM_multiply_naive(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)}, y{random_matrix(n)};
+	for (auto _ : state) {
+		concrete::matrix<int32_t> z(n, n);
+		for (std::size_t i{0}; i != n; ++i) {
+			for (std::size_t j{0}; j != n; ++j) {
+				int32_t t{min_plus::zero};
+				for (std::size_t k{0}; k != n; ++k) {
+					t = std::min(t, x[i][k] + y[k][j]);
+				}
+				z[i][j] = t;
+			}
+		}
+		benchmark::DoNotOptimize(z.data());
+	}
+	set_gops(state, n);
+}
+
+static void BM_multiply_tiled(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)}, y{random_matrix(n)};
+	for (auto _ : state) {
+		auto z{concrete::semiring_multiply<concrete::minimum<int32_t>, concrete::add<int32_t>>(x, y)};
+		benchmark::DoNotOptimize(z.data());
+	}
+	set_gops(state, n);
+}
+
+static void BM_closure_naive(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)};
+	for (auto _ : state) {
+		auto z{x};
+		for (std::size_t k{0}; k != n; ++k) {
+			for (std::size_t i{0}; i != n; ++i) {
+				for (std::size_t j{0}; j != n; ++j) {
+					z[i][j] = std::min(z[i][j], z[i][k] + z[k][j]);
+				}
+			}
+		}
+		benchmark::DoNotOptimize(z.data());
+	}
+	set_gops(state, n);
+}
+
+static void BM_closure_tiled(benchmark::State& state) {
+	std::size_t n{(std::size_t)state.range(0)};
+	auto x{random_matrix(n)};
+	for (auto _ : state) {
+		auto z{x};
+		concrete::semiring_closure<concrete::minimum<int32_t>, concrete::add<int32_t>>(z);
+		benchmark::DoNotOptimize(z.data());
+	}
+	set_gops(state, n);
+}
+
+BENCHMARK(BM_multiply_naive)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_multiply_tiled)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_closure_naive)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_closure_tiled)->RangeMultiplier(2)->Range(64, 1024)->Unit(benchmark::kMillisecond);
+
+//BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,250 @@
+#pragma once
+
+#include "int_m.h"
+#include "math.h"
+#include "standard.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace ntt {
+
+			constexpr ::std::size_t naive_threshold{64};
+
+			template<class T>
+			struct traits {
+				static constexpr bool value{false};
+			};
+
+			template<auto m>
+			struct traits<::concrete::int_m<m>> {
+				using value_type = typename ::concrete::int_m<m>::value_type;
+
+				static constexpr int level{::concrete::countr_zero(value_type(m - 1))};
+				static constexpr bool value{::concrete::is_prime(m) && level > 1};
+
+				static constexpr ::concrete::int_m<m> root() noexcept {
+					value_type c{2};
+					while (::concrete::kronecker_symbol(c, m) != -1) {
+						++c;
+					}
+					return ::concrete::power(::concrete::int_m<m>{c}, value_type(m - 1) >> level);
+				}
+			};
+
+			template<class T>
+			const ::std::vector<T>& roots(::std::size_t size, bool inverse) {
+				thread_local ::std::vector<T> cache[2];
+				::std::vector<T>& w{cache[inverse]};
+				if (w.size() < size) {
+					w.assign(size, T{1});
+					T r{traits<T>::root()};
+					if (inverse) {
+						r = ::concrete::inverse(r);
+					}
+					for (::std::size_t i{size}; i != ((::std::size_t)1 << traits<T>::level); i <<= 1) {
+						r *= r;
+					}
+					for (::std::size_t j{1}; j < size >> 1; ++j) {
+						w[(size >> 1) + j] = w[(size >> 1) + j - 1] * r;
+					}
+					for (::std::size_t len{size >> 2}; len != 0; len >>= 1) {
+						for (::std::size_t j{0}; j != len; ++j) {
+							w[len + j] = w[(len + j) << 1];
+						}
+					}
+				}
+				return w;
+			}
+
+			template<class T>
+			void transform(T* a, ::std::size_t size) {
+				const T* w{::concrete::detail::ntt::roots<T>(size, false).data()};
+				for (::std::size_t len{size >> 1}; len != 0; len >>= 1) {
+					for (::std::size_t i{0}; i != size; i += len << 1) {
+						for (::std::size_t j{0}; j != len; ++j) {
+							T u{a[i + j]}, v{a[i + j + len]};
+							a[i + j] = u + v;
+							a[i + j + len] = (u - v) * w[len + j];
+						}
+					}
+				}
+			}
+
+			template<class T>
+			void inverse_transform(T* a, ::std::size_t size, bool normalize = true) {
+				const T* w{::concrete::detail::ntt::roots<T>(size, true).data()};
+				for (::std::size_t len{1}; len != size; len <<= 1) {
+					for (::std::size_t i{0}; i != size; i += len << 1) {
+						for (::std::size_t j{0}; j != len; ++j) {
+							T u{a[i + j]}, v{a[i + j + len] * w[len + j]};
+							a[i + j] = u + v;
+							a[i + j + len] = u - v;
+						}
+					}
+				}
+				if (normalize) {
+					T inv{::concrete::inverse(T{(typename T::value_type)size})};
+					for (::std::size_t i{0}; i != size; ++i) {
+						a[i] *= inv;
+					}
+				}
+			}
+
+			template<class T>
+			bool is_available(::std::size_t size) noexcept {
+				if constexpr (traits<T>::value) {
+					return ::concrete::bit_ceil(size) <= ((::std::size_t)1 << traits<T>::level);
+				}
+				else {
+					return false;
+				}
+			}
+
+			template<class U, class T>
+			::std::vector<U> convolve(const ::std::vector<T>& x, const ::std::vector<T>& y, bool normalize) {
+				auto load{[](const ::std::vector<T>& v, ::std::size_t n) {
+					::std::vector<U> res(n);
+					for (::std::size_t i{0}; i != v.size(); ++i) {
+						if constexpr (::std::is_same_v<U, T>) {
+							res[i] = v[i];
+						}
+						else if constexpr (::concrete::is_int_m_v<T>) {
+							res[i] = U{(typename U::value_type)(typename T::value_type)v[i]};
+						}
+						else {
+							res[i] = U{(typename U::value_type)v[i]};
+						}
+					}
+					return res;
+				}};
+				::std::size_t n{::concrete::bit_ceil(x.size() + y.size() - 1)};
+				::std::vector<U> a{load(x, n)};
+				::concrete::detail::ntt::transform(a.data(), n);
+				if (&x == &y) {
+					for (::std::size_t i{0}; i != n; ++i) {
+						a[i] *= a[i];
+					}
+				}
+				else {
+					::std::vector<U> b{load(y, n)};
+					::concrete::detail::ntt::transform(b.data(), n);
+					for (::std::size_t i{0}; i != n; ++i) {
+						a[i] *= b[i];
+					}
+				}
+				::concrete::detail::ntt::inverse_transform(a.data(), n, normalize);
+				return a;
+			}
+
+			namespace garner {
+
+				constexpr ::concrete::uint32_t p1{754974721}, p2{167772161}, p3{469762049};
+				constexpr ::std::size_t level{24};
+
+				using int_m1 = ::concrete::int_m<p1>;
+				using int_m2 = ::concrete::int_m<p2>;
+				using int_m3 = ::concrete::int_m<p3>;
+
+				template<class T>
+				struct is_available : ::std::false_type {};
+
+				template<auto m>
+				struct is_available<::concrete::int_m<m>> : ::std::bool_constant<sizeof(typename ::concrete::int_m<m>::value_type) == 4> {};
+
+				template<class T>
+				constexpr ::concrete::uint64_t plain(T x) noexcept {
+					return (typename T::value_type)x;
+				}
+
+				template<class T>
+				constexpr T montgomery(T x) noexcept {
+					return x * T{T{1}.raw()};
+				}
+
+				template<class T>
+				constexpr ::concrete::uint64_t negate(::concrete::uint64_t x) noexcept {
+					constexpr ::concrete::uint64_t m{T{}.modular_arithmetic().modulo()};
+					return x == 0 ? 0 : m - x;
+				}
+
+				template<class T>
+				::std::vector<T> convolution(const ::std::vector<T>& x, const ::std::vector<T>& y) {
+					::std::size_t size{x.size() + y.size() - 1};
+					::concrete::uint32_t n{(::concrete::uint32_t)::concrete::bit_ceil(size)};
+					::std::vector<int_m1> a1{::concrete::detail::ntt::convolve<int_m1>(x, y, false)};
+					::std::vector<int_m2> a2{::concrete::detail::ntt::convolve<int_m2>(x, y, false)};
+					::std::vector<int_m3> a3{::concrete::detail::ntt::convolve<int_m3>(x, y, false)};
+
+					const ::concrete::uint64_t c1{plain(::concrete::inverse(int_m1{n}))};
+					const ::concrete::uint64_t c2{plain(::concrete::inverse(int_m2{n} * int_m2{p1}))};
+					const ::concrete::uint64_t c3{negate<int_m2>(plain(montgomery(::concrete::inverse(int_m2{p1}))))};
+					const ::concrete::uint64_t c4{plain(::concrete::inverse(int_m3{n} * int_m3{p1} * int_m3{p2}))};
+					const ::concrete::uint64_t c5{negate<int_m3>(plain(montgomery(::concrete::inverse(int_m3{p1} * int_m3{p2}))))};
+					const ::concrete::uint64_t c6{negate<int_m3>(plain(montgomery(::concrete::inverse(int_m3{p2}))))};
+					const ::concrete::uint64_t c7{plain(montgomery(montgomery(T{1})))};
+					const ::concrete::uint64_t c8{plain(montgomery(montgomery(T{p1})))};
+					const ::concrete::uint64_t c9{plain(montgomery(montgomery(T{p1} * T{p2})))};
+
+					constexpr auto mod1{int_m1{}.modular_arithmetic()};
+					constexpr auto mod2{int_m2{}.modular_arithmetic()};
+					constexpr auto mod3{int_m3{}.modular_arithmetic()};
+					const auto& mod{T{}.modular_arithmetic()};
+					::std::vector<T> res(size);
+					for (::std::size_t i{0}; i != size; ++i) {
+						::concrete::uint64_t x1{mod1.reduce(a1[i].raw() * c1)};
+						x1 = x1 >= p1 ? x1 - p1 : x1;
+						::concrete::uint64_t x2{mod2.reduce(a2[i].raw() * c2 + x1 * c3)};
+						x2 = x2 >= p2 ? x2 - p2 : x2;
+						::concrete::uint64_t x3{mod3.reduce(a3[i].raw() * c4 + x1 * c5 + x2 * c6)};
+						x3 = x3 >= p3 ? x3 - p3 : x3;
+						res[i].raw(mod.reduce(x1 * c7 + x2 * c8 + x3 * c9));
+					}
+					return res;
+				}
+
+			}
+
+		}
+
+		template<class T>
+		::std::vector<T> naive_convolution(const ::std::vector<T>& x, const ::std::vector<T>& y) {
+			::std::vector<T> res(x.size() + y.size() - 1);
+			for (::std::size_t i{0}; i != x.size(); ++i) {
+				for (::std::size_t j{0}; j != y.size(); ++j) {
+					res[i + j] += x[i] * y[j];
+				}
+			}
+			return res;
+		}
+
+	}
+
+	template<class T>
+	::std::vector<T> convolution(const ::std::vector<T>& x, const ::std::vector<T>& y) {
+		if (x.empty() || y.empty()) {
+			return {};
+		}
+		::std::size_t size{x.size() + y.size() - 1};
+		if ((x.size() < y.size() ? x.size() : y.size()) >= ::concrete::detail::ntt::naive_threshold) {
+			if constexpr (::concrete::detail::ntt::traits<T>::value) {
+				if (::concrete::detail::ntt::is_available<T>(size)) {
+					::std::vector<T> res{::concrete::detail::ntt::convolve<T>(x, y, true)};
+					res.resize(size);
+					return res;
+				}
+			}
+			if constexpr (::concrete::detail::ntt::garner::is_available<T>::value) {
+				if (::concrete::bit_ceil(size) <= ((::std::size_t)1 << ::concrete::detail::ntt::garner::level)) {
+					return ::concrete::detail::ntt::garner::convolution(x, y);
+				}
+			}
+		}
+		return ::concrete::detail::naive_convolution(x, y);
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,382 @@
+#pragma once
+
+#include "int_m.h"
+#include "integral.h"
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace fast_io {
+
+			constexpr ::std::size_t buffer_size{1 << 16};
+
+			constexpr ::std::size_t token_size{64};
+
+			constexpr ::concrete::uint64_t ten19{10000000000000000000ull};
+
+			template<class T>
+			constexpr bool is_integer_v{::concrete::detail::wide::is_builtin_v<T> && !::std::is_same_v<T, char>};
+
+			template<class T>
+			constexpr bool is_signed_v{::std::is_signed_v<T> || ::std::is_same_v<T, ::concrete::int128_t>};
+
+			struct digit_pairs {
+				char values[200];
+
+				constexpr digit_pairs() noexcept : values{} {
+					for (int i{0}; i != 100; ++i) {
+						values[i * 2] = (char)('0' + i / 10);
+						values[i * 2 + 1] = (char)('0' + i % 10);
+					}
+				}
+			};
+
+			constexpr ::concrete::detail::fast_io::digit_pairs pairs{};
+
+			inline bool is_eight_digits(::concrete::uint64_t x) noexcept {
+				return ((x & 0xF0F0F0F0F0F0F0F0) | (((x + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+			}
+
+			inline ::concrete::uint32_t parse_eight_digits(::concrete::uint64_t x) noexcept {
+				x -= 0x3030303030303030;
+				x = x * 10 + (x >> 8);
+				return (::concrete::uint32_t)(((x & 0x000000FF000000FF) * (100 + (1000000ull << 32)) + ((x >> 16) & 0x000000FF000000FF) * (1 + (10000ull << 32))) >> 32);
+			}
+
+			inline char* format(char* last, ::concrete::uint64_t x) noexcept {
+				while (x >= 100) {
+					last -= 2;
+					::std::memcpy(last, ::concrete::detail::fast_io::pairs.values + x % 100 * 2, 2);
+					x /= 100;
+				}
+				if (x >= 10) {
+					last -= 2;
+					::std::memcpy(last, ::concrete::detail::fast_io::pairs.values + x * 2, 2);
+					return last;
+				}
+				*--last = (char)('0' + x);
+				return last;
+			}
+
+			inline char* format_padded(char* last, ::concrete::uint64_t x) noexcept {
+				char* first{last - 19};
+				last = ::concrete::detail::fast_io::format(last, x);
+				while (last != first) {
+					*--last = '0';
+				}
+				return last;
+			}
+
+			template<class T>
+			char* format(char* last, T x) noexcept {
+				if constexpr (sizeof(T) <= sizeof(::concrete::uint64_t)) {
+					return ::concrete::detail::fast_io::format(last, (::concrete::uint64_t)x);
+				}
+				else {
+					if (x >> 64 == 0) {
+						return ::concrete::detail::fast_io::format(last, (::concrete::uint64_t)x);
+					}
+					T high{x / ::concrete::detail::fast_io::ten19};
+					last = ::concrete::detail::fast_io::format_padded(last, (::concrete::uint64_t)(x - high * ::concrete::detail::fast_io::ten19));
+					if (high >> 64 == 0) {
+						return ::concrete::detail::fast_io::format(last, (::concrete::uint64_t)high);
+					}
+					T top{high / ::concrete::detail::fast_io::ten19};
+					last = ::concrete::detail::fast_io::format_padded(last, (::concrete::uint64_t)(high - top * ::concrete::detail::fast_io::ten19));
+					return ::concrete::detail::fast_io::format(last, (::concrete::uint64_t)top);
+				}
+			}
+
+		}
+
+	}
+
+	class input {
+		::std::FILE* _file;
+		::std::unique_ptr<char[]> _buffer;
+		const char* _first;
+		const char* _last;
+		char* _mapped;
+		::std::size_t _mappedSize;
+		bool _eof, _fail;
+
+		void _open() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+			int fd{::fileno(_file)};
+			struct stat info {};
+			if (fd != -1 && ::fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0) {
+				off_t offset{::lseek(fd, 0, SEEK_CUR)};
+				void* p{::mmap(nullptr, (::std::size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0)};
+				if (offset != -1 && p != MAP_FAILED) {
+					::madvise(p, (::std::size_t)info.st_size, MADV_SEQUENTIAL);
+					_mapped = (char*)p;
+					_mappedSize = (::std::size_t)info.st_size;
+					_first = _mapped + (offset < info.st_size ? offset : info.st_size);
+					_last = _mapped + _mappedSize;
+					_eof = true;
+					return;
+				}
+				if (p != MAP_FAILED) {
+					::munmap(p, (::std::size_t)info.st_size);
+				}
+			}
+#endif
+			_buffer.reset(new char[::concrete::detail::fast_io::buffer_size + ::concrete::detail::fast_io::token_size]);
+			_first = _last = _buffer.get();
+		}
+
+		void _refill() noexcept {
+			if (_buffer == nullptr) {
+				_open();
+				if (_eof) {
+					return;
+				}
+			}
+			::std::size_t rest{(::std::size_t)(_last - _first)};
+			::std::memmove(_buffer.get(), _first, rest);
+			_first = _buffer.get();
+			_last = _first + rest;
+#if defined(__unix__) || defined(__APPLE__)
+			::ssize_t n{::read(::fileno(_file), _buffer.get() + rest, ::concrete::detail::fast_io::buffer_size)};
+#else
+			::std::size_t n{::std::fread(_buffer.get() + rest, 1, ::concrete::detail::fast_io::buffer_size, _file)};
+#endif
+			if (n <= 0) {
+				_eof = true;
+				return;
+			}
+			_last += n;
+		}
+
+		bool _skip() noexcept {
+			for (;;) {
+				while (_first != _last && (unsigned char)*_first <= ' ') {
+					++_first;
+				}
+				if (_first != _last) {
+					break;
+				}
+				if (_eof) {
+					_fail = true;
+					return false;
+				}
+				_refill();
+			}
+			while (!_eof && (::std::size_t)(_last - _first) < ::concrete::detail::fast_io::token_size) {
+				_refill();
+			}
+			return true;
+		}
+
+		template<class T>
+		T _parse() noexcept {
+			T res{0};
+			bool parsed{false};
+			for (;;) {
+				const char* first{_first};
+				if constexpr (sizeof(T) >= sizeof(::concrete::uint64_t) || ::concrete::is_int_m_v<T>) {
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+					::concrete::uint64_t x{};
+					while (_last - first >= 8 && (::std::memcpy(&x, first, 8), ::concrete::detail::fast_io::is_eight_digits(x))) {
+						res = res * 100000000 + ::concrete::detail::fast_io::parse_eight_digits(x);
+						first += 8;
+					}
+#endif
+				}
+				while (first != _last && (unsigned char)(*first - '0') < 10) {
+					res = res * 10 + (T)(*first++ - '0');
+				}
+				parsed |= first != _first;
+				_first = first;
+				if (first != _last || _eof) {
+					break;
+				}
+				_refill();
+			}
+			if (!parsed) {
+				_fail = true;
+			}
+			return res;
+		}
+
+		template<class T>
+		T _integer() noexcept {
+			using unsigned_type = ::concrete::unsigned_integral_t<sizeof(T)>;
+			if constexpr (::concrete::detail::fast_io::is_signed_v<T>) {
+				bool negative{*_first == '-'};
+				_first += negative || *_first == '+';
+				unsigned_type res{_parse<unsigned_type>()};
+				return (T)(negative ? ~res + 1 : res);
+			}
+			else {
+				_first += *_first == '+';
+				return (T)_parse<unsigned_type>();
+			}
+		}
+
+	public:
+		explicit input(::std::FILE* file = stdin) noexcept : _file{file}, _first{nullptr}, _last{nullptr}, _mapped{nullptr}, _mappedSize{0}, _eof{false}, _fail{false} {}
+
+		input(const input&) = delete;
+
+		input& operator=(const input&) = delete;
+
+		~input() {
+#if defined(__unix__) || defined(__APPLE__)
+			if (_mapped != nullptr) {
+				::munmap(_mapped, _mappedSize);
+			}
+#endif
+		}
+
+		explicit operator bool() const noexcept {
+			return !_fail;
+		}
+
+		template<class T>
+		T read() noexcept {
+			if (!_skip()) {
+				return T{};
+			}
+			if constexpr (::std::is_same_v<T, char>) {
+				return *_first++;
+			}
+			else if constexpr (::std::is_same_v<T, ::std::string>) {
+				::std::string res;
+				for (;;) {
+					const char* first{_first};
+					while (_first != _last && (unsigned char)*_first > ' ') {
+						++_first;
+					}
+					res.append(first, _first);
+					if (_first != _last || _eof) {
+						return res;
+					}
+					_refill();
+				}
+			}
+			else if constexpr (::concrete::is_int_m_v<T>) {
+				bool negative{*_first == '-'};
+				_first += negative || *_first == '+';
+				T res{_parse<T>()};
+				return negative ? -res : res;
+			}
+			else {
+				static_assert(::concrete::detail::fast_io::is_integer_v<T>, "T should be an integral type, char, std::string or int_m.");
+				return _integer<T>();
+			}
+		}
+
+		template<class T>
+		input& operator>>(T& x) noexcept {
+			x = read<T>();
+			return *this;
+		}
+	};
+
+	class output {
+		::std::FILE* _file;
+		::std::unique_ptr<char[]> _buffer;
+		::std::size_t _size;
+
+		void _write(const char* first, ::std::size_t size) noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+			int fd{::fileno(_file)};
+			::std::fflush(_file);
+			while (size != 0) {
+				::ssize_t n{::write(fd, first, size)};
+				if (n <= 0) {
+					return;
+				}
+				first += n;
+				size -= (::std::size_t)n;
+			}
+#else
+			::std::fwrite(first, 1, size, _file);
+			::std::fflush(_file);
+#endif
+		}
+
+		char* _reserve(::std::size_t size) noexcept {
+			if (::concrete::detail::fast_io::buffer_size - _size < size) {
+				flush();
+			}
+			return _buffer.get() + _size;
+		}
+
+	public:
+		explicit output(::std::FILE* file = stdout) : _file{file}, _buffer{new char[::concrete::detail::fast_io::buffer_size]}, _size{0} {}
+
+		output(const output&) = delete;
+
+		output& operator=(const output&) = delete;
+
+		~output() {
+			flush();
+		}
+
+		void flush() noexcept {
+			_write(_buffer.get(), _size);
+			_size = 0;
+		}
+
+		template<class T>
+		void write(const T& x) noexcept {
+			if constexpr (::std::is_same_v<T, char>) {
+				*_reserve(1) = x;
+				++_size;
+			}
+			else if constexpr (::std::is_convertible_v<const T&, ::std::string_view>) {
+				::std::string_view s{x};
+				if (s.size() > ::concrete::detail::fast_io::buffer_size / 2) {
+					flush();
+					_write(s.data(), s.size());
+					return;
+				}
+				::std::memcpy(_reserve(s.size()), s.data(), s.size());
+				_size += s.size();
+			}
+			else if constexpr (::concrete::is_int_m_v<T>) {
+				write((typename T::value_type)x);
+			}
+			else {
+				static_assert(::concrete::detail::fast_io::is_integer_v<T>, "T should be an integral type, char, a string or int_m.");
+				using unsigned_type = ::concrete::unsigned_integral_t<sizeof(T)>;
+				char* p{_reserve(::concrete::detail::fast_io::token_size)};
+				unsigned_type value{(unsigned_type)x};
+				if constexpr (::concrete::detail::fast_io::is_signed_v<T>) {
+					if (x < 0) {
+						*p++ = '-';
+						++_size;
+						value = ~value + 1;
+					}
+				}
+				char digits[::concrete::detail::fast_io::token_size];
+				char* last{digits + ::concrete::detail::fast_io::token_size};
+				char* first{::concrete::detail::fast_io::format(last, value)};
+				::std::memcpy(p, first, (::std::size_t)(last - first));
+				_size += (::std::size_t)(last - first);
+			}
+		}
+
+		template<class T>
+		output& operator<<(const T& x) noexcept {
+			write(x);
+			return *this;
+		}
+	};
+
+}
\ No newline at end of file
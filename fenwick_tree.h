@@ -1,19 +1,37 @@
 #pragma once
 
+#include "integral.h"
+#include "numeric.h"
 #include "operator.h"
+#include "standard.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace concrete {
 
-	template <class T, class Op = ::concrete::add<T>>
-	class fenwick_tree : private ::std::vector<T> {
-		using base = ::std::vector<T>;
+	template <class T, class Op = ::concrete::add<T>, class Allocator = ::std::allocator<T>>
+	class fenwick_tree : private ::std::vector<T, Allocator> {
+		using base = ::std::vector<T, Allocator>;
 
 		static constexpr ::concrete::assignment_operator_t<Op> _op{};
 
-		T& _at(::std::size_t index) noexcept {
-			return base::operator[](index);
-		}
-
 		template<class Fn>
 		void _apply(::std::size_t index, Fn function) {
 			::std::size_t size{this->size()};
@@ -23,12 +41,52 @@ namespace concrete {
 			}
 		}
 
-	public:
-		explicit fenwick_tree(::std::size_t size) noexcept : base(size) {}
+		static constexpr bool _parallel_build{::concrete::algebraic_traits<Op>::associative && ::concrete::algebraic_traits<Op>::commutative};
+
+		void _build_parallel(::std::size_t count) {
+			::std::size_t size{this->size()};
+			::concrete::detail::parallel::for_each_block(size, count, [&](::std::size_t, ::std::size_t first, ::std::size_t last) {
+				for (::std::size_t i{first}; i != last; ++i) {
+					::std::size_t j{i | (i + 1)};
+					if (j < last) {
+						_op(_at(j), _at(i));
+					}
+				}
+			});
+			for (::std::size_t t{1}; t != count; ++t) {
+				::std::size_t first{size * t / count}, last{size * (t + 1) / count};
+				for (::std::size_t i{(first - 1) | first}; i < last; i |= i + 1) {
+					::std::size_t k{first - 1}, begin{i & (i + 1)};
+					T missing{_at(k)};
+					while ((k & (k + 1)) != begin) {
+						k = (k & (k + 1)) - 1;
+						_op(missing, _at(k));
+					}
+					_op(_at(i), missing);
+				}
+			}
+		}
+
+	protected:
+		struct _unbuilt {};
+
+		using base::size;
 
 		template <class input_iterator>
-		explicit fenwick_tree(input_iterator first, input_iterator last) noexcept : base(first, last) {
+		fenwick_tree(_unbuilt, input_iterator first, input_iterator last, const Allocator& allocator) : base(first, last, allocator) {}
+
+		T& _at(::std::size_t index) noexcept {
+			return base::operator[](index);
+		}
+
+		void _build() {
 			::std::size_t size{this->size()};
+			if constexpr (_parallel_build) {
+				if (::std::size_t count{::concrete::detail::parallel::thread_count(size)}; count > 1) {
+					_build_parallel(count);
+					return;
+				}
+			}
 			for (::std::size_t i{0}; i != size; ++i) {
 				::std::size_t j{i | i + 1};
 				if (j < size) {
@@ -37,6 +95,18 @@ namespace concrete {
 			}
 		}
 
+	public:
+		using allocator_type = Allocator;
+
+		explicit fenwick_tree(::std::size_t size, const Allocator& allocator = Allocator{}) noexcept : base(size, allocator) {}
+
+		template <class input_iterator>
+		explicit fenwick_tree(input_iterator first, input_iterator last, const Allocator& allocator = Allocator{}) noexcept : base(first, last, allocator) {
+			_build();
+		}
+
+		using base::get_allocator;
+
 		void apply(::std::size_t index, const T& value) noexcept {
 			_apply(index, [&](T& x) { _op(x, value); });
 		}
@@ -60,34 +130,694 @@ namespace concrete {
 		}
 	};
 
-	template <class T, class Op = ::concrete::add<T>>
-	class fenwick_tree_diff : private fenwick_tree<T, Op> {
+	template <class T, class Op = ::concrete::add<T>, class Allocator = ::std::allocator<T>>
+	class fenwick_tree_diff : private fenwick_tree<T, Op, Allocator> {
 		static_assert(::concrete::is_group_v<Op>, "Op should be invertible.");
 
-		using base = fenwick_tree<T, Op>;
+		using base = fenwick_tree<T, Op, Allocator>;
 
 		static constexpr auto _invOp{::concrete::inverse_assignment_operator_t<Op>{}};
 
-		template <class input_iterator>
-		static base _construct(input_iterator first, input_iterator last) {
-			::std::vector<T> diff(first, last);
-			for (::std::size_t i{diff.size() - 1}; i != 0; --i) {
-				diff[i] = _invOp(diff[i], diff[i - 1]);
-			}
-			return base{diff.begin(), diff.end()};
-		}
-
 	public:
+		using typename base::allocator_type;
+		using base::get_allocator;
 		using base::operator[];
 
-		explicit fenwick_tree_diff(::std::size_t size) noexcept : base{size} {}
+		explicit fenwick_tree_diff(::std::size_t size, const Allocator& allocator = Allocator{}) noexcept : base{size, allocator} {}
 
 		template <class input_iterator>
-		explicit fenwick_tree_diff(input_iterator first, input_iterator last) noexcept : base{::std::move(_construct(first, last))} {}
+		explicit fenwick_tree_diff(input_iterator first, input_iterator last, const Allocator& allocator = Allocator{}) noexcept :
+			base{typename base::_unbuilt{}, first, last, allocator} {
+			for (::std::size_t i{base::size()}; i > 1; --i) {
+				_invOp(base::_at(i - 1), base::_at(i - 2));
+			}
+			base::_build();
+		}
 
 		void apply(::std::size_t first, ::std::size_t last, const T& value) noexcept {
 			base::apply(first, value);
 			base::apply_inverse(last, value);
 		}
 	};
+
+	template <class T, class Op = ::concrete::add<T>>
+	class fenwick_tree_atomic : private ::std::vector<::std::atomic<T>> {
+		static_assert(::concrete::is_semigroup_v<Op> && ::concrete::algebraic_traits<Op>::commutative,
+			"Op should be associative and commutative.");
+
+		using base = ::std::vector<::std::atomic<T>>;
+
+		static constexpr bool _fetch_add{::std::is_same_v<Op, ::concrete::add<T>> && ::std::is_integral_v<T>};
+
+		static constexpr Op _op{};
+
+		::std::atomic<T>& _at(::std::size_t index) noexcept {
+			return base::operator[](index);
+		}
+
+		static void _update(::std::atomic<T>& node, const T& value) noexcept {
+			if constexpr (_fetch_add) {
+				node.fetch_add(value, ::std::memory_order_release);
+			}
+			else {
+				T expected{node.load(::std::memory_order_relaxed)};
+				while (!node.compare_exchange_weak(expected, _op(expected, value), ::std::memory_order_release, ::std::memory_order_relaxed)) {}
+			}
+		}
+
+	public:
+		explicit fenwick_tree_atomic(::std::size_t size) noexcept : base(size) {}
+
+		template <class input_iterator>
+		explicit fenwick_tree_atomic(input_iterator first, input_iterator last) noexcept : base(::std::distance(first, last)) {
+			::std::size_t size{this->size()};
+			for (::std::size_t i{0}; i != size; ++i, ++first) {
+				_at(i).store(*first, ::std::memory_order_relaxed);
+			}
+			for (::std::size_t i{0}; i != size; ++i) {
+				::std::size_t j{i | (i + 1)};
+				if (j < size) {
+					_at(j).store(_op(_at(j).load(::std::memory_order_relaxed), _at(i).load(::std::memory_order_relaxed)), ::std::memory_order_relaxed);
+				}
+			}
+			::std::atomic_thread_fence(::std::memory_order_release);
+		}
+
+		using base::size;
+
+		void apply(::std::size_t index, const T& value) noexcept {
+			::std::size_t size{this->size()};
+			while (index < size) {
+				_update(_at(index), value);
+				index |= index + 1;
+			}
+		}
+
+		void apply_inverse(::std::size_t index, const T& value) noexcept {
+			static_assert(::concrete::is_group_v<Op>, "Op should be invertible.");
+
+			apply(index, ::concrete::inverse_operator_t<Op>{}(::concrete::algebraic_traits<Op>::identity, value));
+		}
+
+		T operator[](::std::size_t index) noexcept {
+			T res{};
+			::std::size_t size{this->size()};
+			while (index < size) {
+				res = _op(res, _at(index).load(::std::memory_order_acquire));
+				index &= index + 1;
+				--index;
+			}
+			return res;
+		}
+	};
+
+	template <class T, class Op = ::concrete::add<T>>
+	class fenwick_tree_sharded {
+		using shard_type = ::concrete::fenwick_tree_atomic<T, Op>;
+
+		static constexpr Op _op{};
+
+		::std::vector<shard_type> _shards;
+
+		shard_type& _local() noexcept {
+			static ::std::atomic<::std::size_t> counter{0};
+			thread_local ::std::size_t id{counter.fetch_add(1, ::std::memory_order_relaxed)};
+			return _shards[id % _shards.size()];
+		}
+
+	public:
+		explicit fenwick_tree_sharded(::std::size_t size, ::std::size_t shards = ::std::thread::hardware_concurrency()) {
+			shards = shards == 0 ? 1 : shards;
+			_shards.reserve(shards);
+			for (::std::size_t i{0}; i != shards; ++i) {
+				_shards.emplace_back(size);
+			}
+		}
+
+		template <class input_iterator>
+		explicit fenwick_tree_sharded(input_iterator first, input_iterator last, ::std::size_t shards = ::std::thread::hardware_concurrency()) {
+			shards = shards == 0 ? 1 : shards;
+			_shards.reserve(shards);
+			_shards.emplace_back(first, last);
+			::std::size_t size{_shards.front().size()};
+			for (::std::size_t i{1}; i != shards; ++i) {
+				_shards.emplace_back(size);
+			}
+		}
+
+		::std::size_t size() const noexcept {
+			return _shards.front().size();
+		}
+
+		void apply(::std::size_t index, const T& value) noexcept {
+			_local().apply(index, value);
+		}
+
+		void apply_inverse(::std::size_t index, const T& value) noexcept {
+			_local().apply_inverse(index, value);
+		}
+
+		T operator[](::std::size_t index) noexcept {
+			T res{};
+			for (shard_type& shard : _shards) {
+				res = _op(res, shard[index]);
+			}
+			return res;
+		}
+	};
+
+	template <class T, class Op = ::concrete::add<T>, ::std::size_t block_size = 64>
+	class fenwick_tree_persistent {
+		static_assert(::concrete::has_single_bit(block_size), "block_size should be a power of 2.");
+
+		struct _node {
+			::std::vector<::std::shared_ptr<_node>> children;
+			::std::vector<T> values;
+		};
+
+		using _pointer = ::std::shared_ptr<_node>;
+
+		static constexpr ::concrete::assignment_operator_t<Op> _op{};
+		static constexpr ::std::size_t _shift{(::std::size_t)::concrete::countr_zero(block_size)};
+
+		::std::size_t _size, _depth;
+		_pointer _root;
+
+		static ::std::size_t _compute_depth(::std::size_t size) noexcept {
+			::std::size_t depth{0};
+			::std::size_t capacity{block_size};
+			while (capacity < size && capacity >> (sizeof(::std::size_t) * 8 - _shift) == 0) {
+				capacity <<= _shift;
+				++depth;
+			}
+			return depth;
+		}
+
+		static _pointer _build_empty(::std::size_t depth) {
+			_pointer res{::std::make_shared<_node>()};
+			res->values.resize(block_size);
+			while (depth-- != 0) {
+				_pointer parent{::std::make_shared<_node>()};
+				parent->children.assign(block_size, res);
+				res = ::std::move(parent);
+			}
+			return res;
+		}
+
+		static _pointer _build(const ::std::vector<T>& values, ::std::size_t depth, ::std::size_t offset) {
+			_pointer res{::std::make_shared<_node>()};
+			if (depth == 0) {
+				res->values.resize(block_size);
+				for (::std::size_t i{0}; i != block_size && offset + i < values.size(); ++i) {
+					res->values[i] = values[offset + i];
+				}
+				return res;
+			}
+			::std::size_t span{block_size << (_shift * (depth - 1))};
+			res->children.resize(block_size);
+			for (::std::size_t i{0}; i != block_size && offset < values.size(); ++i, offset += span) {
+				res->children[i] = _build(values, depth - 1, offset);
+			}
+			return res;
+		}
+
+		static _node& _unique(_pointer& node) {
+			if (node.use_count() != 1) {
+				node = ::std::make_shared<_node>(*node);
+			}
+			return *node;
+		}
+
+		T& _mutable_at(::std::size_t index) {
+			_pointer* node{&_root};
+			for (::std::size_t level{_depth}; level != 0; --level) {
+				node = &_unique(*node).children[(index >> (_shift * level)) & (block_size - 1)];
+			}
+			return _unique(*node).values[index & (block_size - 1)];
+		}
+
+		const T& _at(::std::size_t index) const noexcept {
+			const _node* node{_root.get()};
+			for (::std::size_t level{_depth}; level != 0; --level) {
+				node = node->children[(index >> (_shift * level)) & (block_size - 1)].get();
+			}
+			return node->values[index & (block_size - 1)];
+		}
+
+		template<class Fn>
+		void _apply(::std::size_t index, Fn function) {
+			while (index < _size) {
+				function(_mutable_at(index));
+				index |= index + 1;
+			}
+		}
+
+	public:
+		explicit fenwick_tree_persistent(::std::size_t size) : _size{size}, _depth{_compute_depth(size)}, _root{_build_empty(_depth)} {}
+
+		template <class input_iterator>
+		explicit fenwick_tree_persistent(input_iterator first, input_iterator last) {
+			::std::vector<T> values(first, last);
+			_size = values.size();
+			for (::std::size_t i{0}; i != _size; ++i) {
+				::std::size_t j{i | (i + 1)};
+				if (j < _size) {
+					_op(values[j], values[i]);
+				}
+			}
+			_depth = _compute_depth(_size);
+			_root = _build(values, _depth, 0);
+		}
+
+		fenwick_tree_persistent snapshot() const noexcept {
+			return *this;
+		}
+
+		::std::size_t size() const noexcept {
+			return _size;
+		}
+
+		void apply(::std::size_t index, const T& value) {
+			_apply(index, [&](T& x) { _op(x, value); });
+		}
+
+		void apply_inverse(::std::size_t index, const T& value) {
+			static_assert(::concrete::is_group_v<Op>, "Op should be invertible.");
+
+			static constexpr auto invOp{::concrete::inverse_assignment_operator_t<Op>{}};
+			_apply(index, [&](T& x) { invOp(x, value); });
+		}
+
+		T operator[](::std::size_t index) const noexcept {
+			T res{};
+			while (index < _size) {
+				_op(res, _at(index));
+				index &= index + 1;
+				--index;
+			}
+			return res;
+		}
+	};
+
+	template <class T, class Op = ::concrete::add<T>>
+	class fenwick_tree_sparse {
+		static constexpr ::concrete::assignment_operator_t<Op> _op{};
+		static constexpr ::concrete::uint64_t _empty{~::concrete::uint64_t{0}};
+
+		::concrete::uint64_t _size;
+		::std::vector<::concrete::uint64_t> _keys;
+		::std::vector<T> _values;
+		::std::size_t _count;
+		int _bits;
+
+		::std::size_t _hash(::concrete::uint64_t key) const noexcept {
+			return (::std::size_t)((key * 0x9e3779b97f4a7c15) >> (64 - _bits));
+		}
+
+		void _rehash(int bits) {
+			::std::vector<::concrete::uint64_t> keys(::std::size_t{1} << bits, _empty);
+			::std::vector<T> values(::std::size_t{1} << bits);
+			::concrete::swap(keys, _keys);
+			::concrete::swap(values, _values);
+			_bits = bits;
+			::std::size_t mask{_keys.size() - 1};
+			for (::std::size_t i{0}; i != keys.size(); ++i) {
+				if (keys[i] != _empty) {
+					::std::size_t j{_hash(keys[i])};
+					while (_keys[j] != _empty) {
+						j = (j + 1) & mask;
+					}
+					_keys[j] = keys[i];
+					_values[j] = ::std::move(values[i]);
+				}
+			}
+		}
+
+		T& _insert(::concrete::uint64_t key) {
+			if ((_count + 1) * 2 > _keys.size()) {
+				_rehash(_bits + 1);
+			}
+			::std::size_t mask{_keys.size() - 1};
+			::std::size_t i{_hash(key)};
+			while (_keys[i] != key) {
+				if (_keys[i] == _empty) {
+					_keys[i] = key;
+					++_count;
+					break;
+				}
+				i = (i + 1) & mask;
+			}
+			return _values[i];
+		}
+
+		const T* _find(::concrete::uint64_t key) const noexcept {
+			::std::size_t mask{_keys.size() - 1};
+			::std::size_t i{_hash(key)};
+			while (_keys[i] != key) {
+				if (_keys[i] == _empty) {
+					return nullptr;
+				}
+				i = (i + 1) & mask;
+			}
+			return &_values[i];
+		}
+
+		template<class Fn>
+		void _apply(::concrete::uint64_t index, Fn function) {
+			while (index < _size) {
+				function(_insert(index));
+				index |= index + 1;
+			}
+		}
+
+	public:
+		explicit fenwick_tree_sparse(::concrete::uint64_t size = _empty) : _size{size}, _keys(16, _empty), _values(16), _count{0}, _bits{4} {}
+
+		::concrete::uint64_t size() const noexcept {
+			return _size;
+		}
+
+		::std::size_t node_count() const noexcept {
+			return _count;
+		}
+
+		void reserve(::std::size_t count) {
+			int bits{::concrete::bit_width(count * 2 - (count != 0))};
+			if (bits > _bits) {
+				_rehash(bits);
+			}
+		}
+
+		void apply(::concrete::uint64_t index, const T& value) {
+			_apply(index, [&](T& x) { _op(x, value); });
+		}
+
+		void apply_inverse(::concrete::uint64_t index, const T& value) {
+			static_assert(::concrete::is_group_v<Op>, "Op should be invertible.");
+
+			static constexpr auto invOp{::concrete::inverse_assignment_operator_t<Op>{}};
+			_apply(index, [&](T& x) { invOp(x, value); });
+		}
+
+		T operator[](::concrete::uint64_t index) const noexcept {
+			T res{};
+			while (index < _size) {
+				if (const T* node{_find(index)}; node != nullptr) {
+					_op(res, *node);
+				}
+				index &= index + 1;
+				--index;
+			}
+			return res;
+		}
+	};
+
+	template <class T, class Op = ::concrete::add<T>>
+	class fenwick_tree_compressed {
+		::std::vector<::concrete::uint64_t> _keys;
+		::concrete::fenwick_tree<T, Op> _tree;
+
+		template <class input_iterator>
+		static ::std::vector<::concrete::uint64_t> _compress(input_iterator first, input_iterator last) {
+			::std::vector<::concrete::uint64_t> keys(first, last);
+			::std::sort(keys.begin(), keys.end());
+			keys.erase(::std::unique(keys.begin(), keys.end()), keys.end());
+			return keys;
+		}
+
+		::std::size_t _rank(::concrete::uint64_t key) const noexcept {
+			auto it{::std::lower_bound(_keys.begin(), _keys.end(), key)};
+			return it != _keys.end() && *it == key ? it - _keys.begin() : _keys.size();
+		}
+
+	public:
+		template <class input_iterator>
+		explicit fenwick_tree_compressed(input_iterator first, input_iterator last) : _keys{_compress(first, last)}, _tree{_keys.size()} {}
+
+		const ::std::vector<::concrete::uint64_t>& keys() const noexcept {
+			return _keys;
+		}
+
+		void apply(::concrete::uint64_t key, const T& value) noexcept {
+			_tree.apply(_rank(key), value);
+		}
+
+		void apply_inverse(::concrete::uint64_t key, const T& value) noexcept {
+			_tree.apply_inverse(_rank(key), value);
+		}
+
+		T operator[](::concrete::uint64_t key) noexcept {
+			::std::size_t rank{(::std::size_t)(::std::upper_bound(_keys.begin(), _keys.end(), key) - _keys.begin())};
+			return rank == 0 ? T{} : _tree[rank - 1];
+		}
+	};
+
+#if defined(__unix__) || defined(__APPLE__)
+	namespace detail {
+
+		namespace mapped {
+
+			constexpr char magic[8]{'C', 'O', 'N', 'C', 'R', 'F', 'W', 'T'};
+			constexpr ::concrete::uint32_t version{2};
+
+			struct header {
+				char magic[8];
+				::concrete::uint32_t version;
+				::concrete::uint32_t element_size;
+				::concrete::uint64_t type;
+				::concrete::uint64_t op;
+				::concrete::uint64_t size;
+				::concrete::uint64_t reserved[3];
+			};
+
+			template<class T>
+			constexpr ::concrete::uint64_t type_tag() noexcept {
+				return (::concrete::uint64_t)sizeof(T)
+					| (::concrete::uint64_t)alignof(T) << 32
+					| (::concrete::uint64_t)::concrete::is_integral_v<T> << 48
+					| (::concrete::uint64_t)::concrete::is_signed_v<T> << 49
+					| (::concrete::uint64_t)::std::is_floating_point_v<T> << 50
+					| (::concrete::uint64_t)::std::is_trivially_copyable_v<T> << 51;
+			}
+
+			template<class T, class Op>
+			::concrete::uint64_t op_tag() noexcept {
+				using traits = ::concrete::algebraic_traits<Op>;
+				::concrete::uint64_t res{(::concrete::uint64_t)traits::associative
+					| (::concrete::uint64_t)traits::invertible << 1
+					| (::concrete::uint64_t)traits::commutative << 2
+					| (::concrete::uint64_t)traits::idempotent << 3};
+				if constexpr (::std::is_arithmetic_v<T>) {
+					res |= (::concrete::uint64_t)(::concrete::uint8_t)(::concrete::int64_t)Op{}((T)3, (T)5) << 8;
+				}
+				return res;
+			}
+
+		}
+
+	}
+
+	template <class T, class Op = ::concrete::add<T>>
+	class fenwick_tree_mapped {
+		static_assert(::std::is_trivially_copyable_v<T>, "T should be trivially copyable.");
+
+		using _header = ::concrete::detail::mapped::header;
+
+		static constexpr ::concrete::assignment_operator_t<Op> _op{};
+
+		int _fd;
+		void* _mapping;
+		::std::size_t _mappingSize;
+		T* _data;
+		::std::size_t _size;
+
+		template<class Fn>
+		void _apply(::std::size_t index, Fn function) noexcept {
+			while (index < _size) {
+				function(_data[index]);
+				index |= index + 1;
+			}
+		}
+
+		_header& _head() const noexcept {
+			return *(_header*)_mapping;
+		}
+
+		void _close() noexcept {
+			if (_mapping != nullptr) {
+				::munmap(_mapping, _mappingSize);
+			}
+			if (_fd != -1) {
+				::close(_fd);
+			}
+			_fd = -1;
+			_mapping = nullptr;
+			_mappingSize = 0;
+			_data = nullptr;
+			_size = 0;
+		}
+
+		bool _map(::std::size_t size, bool create) noexcept {
+			_mappingSize = sizeof(_header) + size * sizeof(T);
+			if (create && ::ftruncate(_fd, (off_t)_mappingSize) != 0) {
+				return false;
+			}
+			void* p{::mmap(nullptr, _mappingSize, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0)};
+			if (p == MAP_FAILED) {
+				return false;
+			}
+			_mapping = p;
+			_data = (T*)((char*)p + sizeof(_header));
+			_size = size;
+			return true;
+		}
+
+		bool _create(const char* path, ::std::size_t size) noexcept {
+			_fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+			if (_fd == -1 || !_map(size, true)) {
+				_close();
+				return false;
+			}
+			_header& head{_head()};
+			head.version = ::concrete::detail::mapped::version;
+			head.element_size = (::concrete::uint32_t)sizeof(T);
+			head.type = ::concrete::detail::mapped::type_tag<T>();
+			head.op = ::concrete::detail::mapped::op_tag<T, Op>();
+			head.size = size;
+			const T identity{};
+			const unsigned char zero[sizeof(T)]{};
+			if (::std::memcmp(&identity, zero, sizeof(T)) != 0) {
+				::std::fill(_data, _data + size, identity);
+			}
+			return true;
+		}
+
+		void _seal() noexcept {
+			::std::memcpy(_head().magic, ::concrete::detail::mapped::magic, sizeof(::concrete::detail::mapped::magic));
+			::madvise(_mapping, _mappingSize, MADV_RANDOM);
+		}
+
+	public:
+		explicit fenwick_tree_mapped(const char* path) noexcept : _fd{::open(path, O_RDWR)}, _mapping{nullptr}, _mappingSize{0}, _data{nullptr}, _size{0} {
+			struct stat info {};
+			if (_fd == -1 || ::fstat(_fd, &info) != 0 || (::std::size_t)info.st_size < sizeof(_header)) {
+				_close();
+				return;
+			}
+			_header head{};
+			if (::pread(_fd, &head, sizeof(_header), 0) != (::ssize_t)sizeof(_header)
+				|| ::std::memcmp(head.magic, ::concrete::detail::mapped::magic, sizeof(head.magic)) != 0
+				|| head.version != ::concrete::detail::mapped::version
+				|| head.element_size != sizeof(T)
+				|| head.type != ::concrete::detail::mapped::type_tag<T>()
+				|| head.op != ::concrete::detail::mapped::op_tag<T, Op>()
+				|| head.size > ((::std::size_t)info.st_size - sizeof(_header)) / sizeof(T)
+				|| (::std::size_t)info.st_size != sizeof(_header) + head.size * sizeof(T)
+				|| !_map((::std::size_t)head.size, false)) {
+				_close();
+				return;
+			}
+			::madvise(_mapping, _mappingSize, MADV_RANDOM);
+		}
+
+		fenwick_tree_mapped(const char* path, ::std::size_t size) noexcept : _fd{-1}, _mapping{nullptr}, _mappingSize{0}, _data{nullptr}, _size{0} {
+			if (_create(path, size)) {
+				_seal();
+			}
+		}
+
+		template <class input_iterator>
+		fenwick_tree_mapped(const char* path, input_iterator first, input_iterator last) noexcept : _fd{-1}, _mapping{nullptr}, _mappingSize{0}, _data{nullptr}, _size{0} {
+			static_assert(::std::is_base_of_v<::std::forward_iterator_tag, typename ::std::iterator_traits<input_iterator>::iterator_category>,
+				"input_iterator should be a forward iterator.");
+
+			::std::size_t size{(::std::size_t)::std::distance(first, last)};
+			if (!_create(path, size)) {
+				return;
+			}
+			::madvise(_mapping, _mappingSize, MADV_SEQUENTIAL);
+			for (::std::size_t i{0}; i != size; ++i, ++first) {
+				::std::size_t j{i | (i + 1)};
+				T value{*first};
+				_op(value, _data[i]);
+				_data[i] = value;
+				if (j < size) {
+					_op(_data[j], value);
+				}
+			}
+			_seal();
+		}
+
+		fenwick_tree_mapped(const fenwick_tree_mapped&) = delete;
+
+		fenwick_tree_mapped(fenwick_tree_mapped&& x) noexcept : _fd{x._fd}, _mapping{x._mapping}, _mappingSize{x._mappingSize}, _data{x._data}, _size{x._size} {
+			x._fd = -1;
+			x._mapping = nullptr;
+			x._close();
+		}
+
+		fenwick_tree_mapped& operator=(const fenwick_tree_mapped&) = delete;
+
+		fenwick_tree_mapped& operator=(fenwick_tree_mapped&& x) noexcept {
+			if (this != &x) {
+				_close();
+				::concrete::swap(_fd, x._fd);
+				::concrete::swap(_mapping, x._mapping);
+				::concrete::swap(_mappingSize, x._mappingSize);
+				::concrete::swap(_data, x._data);
+				::concrete::swap(_size, x._size);
+			}
+			return *this;
+		}
+
+		~fenwick_tree_mapped() {
+			_close();
+		}
+
+		explicit operator bool() const noexcept {
+			return _mapping != nullptr;
+		}
+
+		::std::size_t size() const noexcept {
+			return _size;
+		}
+
+		bool checkpoint(bool wait = true) noexcept {
+			return _mapping != nullptr && ::msync(_mapping, _mappingSize, wait ? MS_SYNC : MS_ASYNC) == 0;
+		}
+
+		void apply(::std::size_t index, const T& value) noexcept {
+			_apply(index, [&](T& x) { _op(x, value); });
+		}
+
+		void apply_inverse(::std::size_t index, const T& value) noexcept {
+			static_assert(::concrete::is_group_v<Op>, "Op should be invertible.");
+
+			static constexpr auto invOp{::concrete::inverse_assignment_operator_t<Op>{}};
+			_apply(index, [&](T& x) { invOp(x, value); });
+		}
+
+		T operator[](::std::size_t index) const noexcept {
+			T res{};
+			while (index < _size) {
+				_op(res, _data[index]);
+				index &= index + 1;
+				--index;
+			}
+			return res;
+		}
+	};
+#endif
+
+#if __has_include(<memory_resource>)
+	namespace pmr {
+
+		template <class T, class Op = ::concrete::add<T>>
+		using fenwick_tree = ::concrete::fenwick_tree<T, Op, ::std::pmr::polymorphic_allocator<T>>;
+
+		template <class T, class Op = ::concrete::add<T>>
+		using fenwick_tree_diff = ::concrete::fenwick_tree_diff<T, Op, ::std::pmr::polymorphic_allocator<T>>;
+
+	}
+#endif
 }
\ No newline at end of file
@@ -0,0 +1,421 @@
+#pragma once
+
+#include "integral.h"
+#include "standard.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace hash_map {
+
+			constexpr ::concrete::uint8_t empty{0x80};
+
+			constexpr ::concrete::uint64_t mix(::concrete::uint64_t x) noexcept {
+				x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9;
+				x = (x ^ (x >> 27)) * 0x94D049BB133111EB;
+				return x ^ (x >> 31);
+			}
+
+			template<class T>
+			constexpr ::concrete::uint64_t hash(const T& x) noexcept {
+				if constexpr (sizeof(T) <= 8) {
+					return ::concrete::detail::hash_map::mix((::concrete::uint64_t)x + 0x9E3779B97F4A7C15);
+				}
+				else if constexpr (::concrete::detail::wide::is_builtin_v<T>) {
+					return ::concrete::detail::hash_map::mix((::concrete::uint64_t)x + ::concrete::detail::hash_map::mix((::concrete::uint64_t)(x >> 64) + 0x9E3779B97F4A7C15));
+				}
+				else {
+					::concrete::uint64_t res{0x9E3779B97F4A7C15};
+					for (::std::size_t i{0}; i != sizeof(T) / 8; ++i) {
+						res = ::concrete::detail::hash_map::mix(res + x.data()[i]);
+					}
+					return res;
+				}
+			}
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+			constexpr ::std::size_t group_width{16};
+			constexpr int group_shift{0};
+
+			inline ::concrete::uint32_t match(const ::concrete::uint8_t* control, ::concrete::uint8_t tag) noexcept {
+				__m128i group{_mm_loadu_si128((const __m128i*)control)};
+				return (::concrete::uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8((char)tag)));
+			}
+
+			inline ::concrete::uint32_t match_empty(const ::concrete::uint8_t* control) noexcept {
+				return (::concrete::uint32_t)_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)control));
+			}
+
+			inline void prefetch(const void* x) noexcept {
+				_mm_prefetch((const char*)x, _MM_HINT_T0);
+			}
+#else
+			constexpr ::std::size_t group_width{8};
+			constexpr int group_shift{3};
+
+			inline ::concrete::uint64_t load(const ::concrete::uint8_t* control) noexcept {
+				::concrete::uint64_t res{0};
+				for (::std::size_t i{0}; i != group_width; ++i) {
+					res |= (::concrete::uint64_t)control[i] << (i * 8);
+				}
+				return res;
+			}
+
+			inline ::concrete::uint64_t match(const ::concrete::uint8_t* control, ::concrete::uint8_t tag) noexcept {
+				constexpr ::concrete::uint64_t low{0x0101010101010101}, high{0x8080808080808080};
+				::concrete::uint64_t x{::concrete::detail::hash_map::load(control) ^ (low * tag)};
+				return (x - low) & ~x & high;
+			}
+
+			inline ::concrete::uint64_t match_empty(const ::concrete::uint8_t* control) noexcept {
+				return ::concrete::detail::hash_map::load(control) & 0x8080808080808080;
+			}
+
+			inline void prefetch(const void* x) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+				__builtin_prefetch(x);
+#else
+				(void)x;
+#endif
+			}
+#endif
+
+		}
+
+	}
+
+	template<class Key, class T>
+	class flat_hash_map {
+		static_assert(::concrete::is_integral_v<Key>, "Key should be an integral type.");
+
+	public:
+		using key_type = Key;
+		using mapped_type = T;
+		using value_type = ::std::pair<Key, T>;
+		using size_type = ::std::size_t;
+
+	private:
+		static constexpr ::std::size_t _npos{~::std::size_t{0}};
+		static constexpr ::std::size_t _width{::concrete::detail::hash_map::group_width};
+
+		::std::vector<::concrete::uint8_t> _control;
+		::std::vector<value_type> _slots;
+		::std::size_t _size, _mask;
+		int _shift;
+
+		template<bool is_const>
+		class _iterator {
+			friend class flat_hash_map;
+
+			template<bool>
+			friend class _iterator;
+
+			using _pointer = ::std::conditional_t<is_const, const ::std::pair<Key, T>*, ::std::pair<Key, T>*>;
+
+			const ::concrete::uint8_t* _control;
+			const ::concrete::uint8_t* _last;
+			_pointer _slot;
+
+			constexpr _iterator(const ::concrete::uint8_t* control, const ::concrete::uint8_t* last, _pointer slot) noexcept : _control{control}, _last{last}, _slot{slot} {
+				_skip();
+			}
+
+			constexpr void _skip() noexcept {
+				while (_control != _last && *_control == ::concrete::detail::hash_map::empty) {
+					++_control;
+					++_slot;
+				}
+			}
+
+		public:
+			using iterator_category = ::std::forward_iterator_tag;
+			using value_type = ::std::pair<Key, T>;
+			using difference_type = ::std::ptrdiff_t;
+			using pointer = _pointer;
+			using reference = ::std::conditional_t<is_const, const value_type&, value_type&>;
+
+			constexpr _iterator() noexcept : _control{nullptr}, _last{nullptr}, _slot{nullptr} {}
+
+			constexpr operator _iterator<true>() const noexcept {
+				return _iterator<true>{_control, _last, _slot};
+			}
+
+			constexpr reference operator*() const noexcept {
+				return *_slot;
+			}
+
+			constexpr pointer operator->() const noexcept {
+				return _slot;
+			}
+
+			constexpr _iterator& operator++() noexcept {
+				++_control;
+				++_slot;
+				_skip();
+				return *this;
+			}
+
+			constexpr _iterator operator++(int) noexcept {
+				_iterator res{*this};
+				++*this;
+				return res;
+			}
+
+			constexpr bool operator==(const _iterator& x) const noexcept {
+				return _control == x._control;
+			}
+
+			constexpr bool operator!=(const _iterator& x) const noexcept {
+				return _control != x._control;
+			}
+		};
+
+		::std::size_t _home(::concrete::uint64_t hash) const noexcept {
+			return (::std::size_t)(hash >> _shift);
+		}
+
+		static constexpr ::concrete::uint8_t _tag(::concrete::uint64_t hash) noexcept {
+			return (::concrete::uint8_t)(hash & 0x7F);
+		}
+
+		static constexpr ::std::size_t _index(::concrete::uint64_t bits) noexcept {
+			return (::std::size_t)::concrete::countr_zero(bits) >> ::concrete::detail::hash_map::group_shift;
+		}
+
+		void _set(::std::size_t index, ::concrete::uint8_t tag) noexcept {
+			_control[index] = tag;
+			if (index < _width - 1) {
+				_control[_mask + 1 + index] = tag;
+			}
+		}
+
+		::std::size_t _find(const Key& key, ::concrete::uint64_t hash) const noexcept {
+			::concrete::uint8_t tag{_tag(hash)};
+			::concrete::detail::hash_map::prefetch(_slots.data() + _home(hash));
+			for (::std::size_t position{_home(hash)};; position = (position + _width) & _mask) {
+				const ::concrete::uint8_t* group{_control.data() + position};
+				for (auto bits{::concrete::detail::hash_map::match(group, tag)}; bits != 0; bits &= bits - 1) {
+					::std::size_t index{(position + _index(bits)) & _mask};
+					if (_slots[index].first == key) {
+						return index;
+					}
+				}
+				if (::concrete::detail::hash_map::match_empty(group) != 0) {
+					return _npos;
+				}
+			}
+		}
+
+		::std::size_t _find_empty(::concrete::uint64_t hash) const noexcept {
+			for (::std::size_t position{_home(hash)};; position = (position + _width) & _mask) {
+				if (auto bits{::concrete::detail::hash_map::match_empty(_control.data() + position)}; bits != 0) {
+					return (position + _index(bits)) & _mask;
+				}
+			}
+		}
+
+		void _rehash(::std::size_t capacity) {
+			::std::vector<::concrete::uint8_t> control(capacity + _width - 1, ::concrete::detail::hash_map::empty);
+			::std::vector<value_type> slots(capacity);
+			::concrete::swap(control, _control);
+			::concrete::swap(slots, _slots);
+			_mask = capacity - 1;
+			_shift = 64 - ::concrete::countr_zero(capacity);
+			for (::std::size_t i{0}; i != slots.size(); ++i) {
+				if (control[i] != ::concrete::detail::hash_map::empty) {
+					::concrete::uint64_t hash{::concrete::detail::hash_map::hash(slots[i].first)};
+					::std::size_t index{_find_empty(hash)};
+					_set(index, _tag(hash));
+					_slots[index] = ::std::move(slots[i]);
+				}
+			}
+		}
+
+		static constexpr ::std::size_t _capacity(::std::size_t count) noexcept {
+			::std::size_t res{_width};
+			while (res - (res >> 3) < count) {
+				res <<= 1;
+			}
+			return res;
+		}
+
+		template<class... Args>
+		::std::pair<::std::size_t, bool> _emplace(const Key& key, Args&&... args) {
+			::concrete::uint64_t hash{::concrete::detail::hash_map::hash(key)};
+			if (::std::size_t index{_find(key, hash)}; index != _npos) {
+				return {index, false};
+			}
+			if (_size + 1 > capacity() - (capacity() >> 3)) {
+				_rehash(capacity() << 1);
+			}
+			::std::size_t index{_find_empty(hash)};
+			_set(index, _tag(hash));
+			_slots[index] = value_type{key, T(::std::forward<Args>(args)...)};
+			++_size;
+			return {index, true};
+		}
+
+		void _erase(::std::size_t index) noexcept {
+			for (::std::size_t next{(index + 1) & _mask}; _control[next] != ::concrete::detail::hash_map::empty; next = (next + 1) & _mask) {
+				::std::size_t home{_home(::concrete::detail::hash_map::hash(_slots[next].first))};
+				if (((next - home) & _mask) >= ((next - index) & _mask)) {
+					_set(index, _control[next]);
+					_slots[index] = ::std::move(_slots[next]);
+					index = next;
+				}
+			}
+			_set(index, ::concrete::detail::hash_map::empty);
+			_slots[index] = value_type{};
+			--_size;
+		}
+
+		void _reset() {
+			_control.clear();
+			_slots.clear();
+			_size = 0;
+			_rehash(_width);
+		}
+
+	public:
+		using iterator = _iterator<false>;
+		using const_iterator = _iterator<true>;
+
+		flat_hash_map() : _size{0} {
+			_rehash(_width);
+		}
+
+		explicit flat_hash_map(::std::size_t count) : _size{0} {
+			_rehash(_capacity(count));
+		}
+
+		template <class input_iterator>
+		flat_hash_map(input_iterator first, input_iterator last) : flat_hash_map{} {
+			if constexpr (::std::is_base_of_v<::std::forward_iterator_tag, typename ::std::iterator_traits<input_iterator>::iterator_category>) {
+				reserve((::std::size_t)::std::distance(first, last));
+			}
+			for (; first != last; ++first) {
+				insert(*first);
+			}
+		}
+
+		flat_hash_map(const flat_hash_map&) = default;
+
+		flat_hash_map(flat_hash_map&& x) : _control{::std::move(x._control)}, _slots{::std::move(x._slots)}, _size{x._size}, _mask{x._mask}, _shift{x._shift} {
+			x._reset();
+		}
+
+		flat_hash_map& operator=(const flat_hash_map&) = default;
+
+		flat_hash_map& operator=(flat_hash_map&& x) {
+			if (this != &x) {
+				_control = ::std::move(x._control);
+				_slots = ::std::move(x._slots);
+				_size = x._size;
+				_mask = x._mask;
+				_shift = x._shift;
+				x._reset();
+			}
+			return *this;
+		}
+
+		::std::size_t size() const noexcept {
+			return _size;
+		}
+
+		bool empty() const noexcept {
+			return _size == 0;
+		}
+
+		::std::size_t capacity() const noexcept {
+			return _mask + 1;
+		}
+
+		double load_factor() const noexcept {
+			return (double)_size / (double)capacity();
+		}
+
+		void reserve(::std::size_t count) {
+			if (::std::size_t capacity{_capacity(count)}; capacity > this->capacity()) {
+				_rehash(capacity);
+			}
+		}
+
+		void clear() noexcept {
+			for (::std::size_t i{0}; i != capacity(); ++i) {
+				if (_control[i] != ::concrete::detail::hash_map::empty) {
+					_slots[i] = value_type{};
+				}
+			}
+			::std::fill(_control.begin(), _control.end(), ::concrete::detail::hash_map::empty);
+			_size = 0;
+		}
+
+		iterator begin() noexcept {
+			return iterator{_control.data(), _control.data() + capacity(), _slots.data()};
+		}
+
+		const_iterator begin() const noexcept {
+			return const_iterator{_control.data(), _control.data() + capacity(), _slots.data()};
+		}
+
+		iterator end() noexcept {
+			return iterator{_control.data() + capacity(), _control.data() + capacity(), _slots.data() + capacity()};
+		}
+
+		const_iterator end() const noexcept {
+			return const_iterator{_control.data() + capacity(), _control.data() + capacity(), _slots.data() + capacity()};
+		}
+
+		iterator find(const Key& key) noexcept {
+			::std::size_t index{_find(key, ::concrete::detail::hash_map::hash(key))};
+			return index == _npos ? end() : iterator{_control.data() + index, _control.data() + capacity(), _slots.data() + index};
+		}
+
+		const_iterator find(const Key& key) const noexcept {
+			::std::size_t index{_find(key, ::concrete::detail::hash_map::hash(key))};
+			return index == _npos ? end() : const_iterator{_control.data() + index, _control.data() + capacity(), _slots.data() + index};
+		}
+
+		bool contains(const Key& key) const noexcept {
+			return _find(key, ::concrete::detail::hash_map::hash(key)) != _npos;
+		}
+
+		::std::size_t count(const Key& key) const noexcept {
+			return contains(key);
+		}
+
+		template<class... Args>
+		::std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+			auto [index, inserted] {_emplace(key, ::std::forward<Args>(args)...)};
+			return {iterator{_control.data() + index, _control.data() + capacity(), _slots.data() + index}, inserted};
+		}
+
+		::std::pair<iterator, bool> insert(const value_type& value) {
+			return try_emplace(value.first, value.second);
+		}
+
+		T& operator[](const Key& key) {
+			return _slots[_emplace(key).first].second;
+		}
+
+		::std::size_t erase(const Key& key) noexcept {
+			::std::size_t index{_find(key, ::concrete::detail::hash_map::hash(key))};
+			if (index == _npos) {
+				return 0;
+			}
+			_erase(index);
+			return 1;
+		}
+	};
+
+}
\ No newline at end of file
@@ -6,14 +6,48 @@
 namespace concrete {
 
 	template<class T>
+	class modular_constant {
+		static_assert(::concrete::is_integral_v<T>, "T should be an integral type.");
+
+	public:
+		using value_type = ::concrete::make_unsigned_t<T>;
+		using double_type = ::concrete::unsigned_integral_t<sizeof(value_type) * 2>;
+
+	private:
+		value_type _w, _wShoup;
+
+	public:
+		constexpr modular_constant() noexcept : _w{0}, _wShoup{0} {}
+
+		constexpr modular_constant(value_type w, value_type modulo) noexcept :
+			_w{w},
+			_wShoup{(value_type)((double_type{w} << (sizeof(value_type) * 8)) / modulo)} {}
+
+		constexpr value_type value() const noexcept {
+			return _w;
+		}
+
+		constexpr value_type quotient() const noexcept {
+			return _wShoup;
+		}
+
+		constexpr value_type multiply(value_type x, value_type modulo) const noexcept {
+			value_type q{(value_type)((double_type{x} * _wShoup) >> (sizeof(value_type) * 8))};
+			return x * _w - q * modulo;
+		}
+	};
+
+	template<class T, bool strict = false>
 	class modular_arithmetic {
 		static_assert(::concrete::is_integral_v<T>, "T should be an integral type.");
 
 	public:
 		using value_type = ::concrete::make_unsigned_t<T>;
+		using double_type = ::concrete::unsigned_integral_t<sizeof(value_type) * 2>;
+		using constant_type = ::concrete::modular_constant<value_type>;
 
 	private:
-		using _double = ::concrete::unsigned_integral_t<sizeof(value_type) * 2>;
+		using _double = double_type;
 
 		const value_type _m, _mDouble, _mInverseNegate, _r, _rSquare;
 
@@ -27,7 +61,14 @@ namespace concrete {
 		}
 
 		constexpr value_type _reduce(_double x) const noexcept {
-			return value_type{(x + _double{(value_type)x * _mInverseNegate} *_m) >> (sizeof(value_type) * 8)};
+			if constexpr (strict) {
+				value_type q{(value_type)x * (value_type)(~_mInverseNegate + 1)};
+				value_type h{(value_type)(_double{q} * _m >> (sizeof(value_type) * 8))}, xh{(value_type)(x >> (sizeof(value_type) * 8))};
+				return xh >= h ? xh - h : xh - h + _m;
+			}
+			else {
+				return value_type{(x + _double{(value_type)x * _mInverseNegate} *_m) >> (sizeof(value_type) * 8)};
+			}
 		}
 
 	public:
@@ -42,14 +83,23 @@ namespace concrete {
 			return _m;
 		}
 
+		constexpr value_type reduce(double_type xR) const noexcept {
+			return _reduce(xR);
+		}
+
 		constexpr value_type operator()(value_type x) const noexcept {
 			return _reduce(_double{x} *_rSquare);
 		}
 
 		constexpr value_type to(value_type xR) const noexcept {
 			value_type res{_reduce(xR)};
-			value_type t{res - _m};
-			return t >> (sizeof(value_type) * 8 - 1) == 0 ? t : res;
+			if constexpr (strict) {
+				return res;
+			}
+			else {
+				value_type t{res - _m};
+				return t >> (sizeof(value_type) * 8 - 1) == 0 ? t : res;
+			}
 		}
 
 		constexpr bool equal(value_type xR, value_type yR) const noexcept {
@@ -77,24 +127,49 @@ namespace concrete {
 		}
 
 		constexpr value_type negate(value_type xR) const noexcept {
-			return xR == 0 ? 0 : _mDouble - xR;
+			return xR == 0 ? 0 : (strict ? _m : _mDouble) - xR;
 		}
 
 		constexpr value_type add(value_type xR, value_type yR) const noexcept {
-			xR += yR;
-			value_type t{xR - _mDouble};
-			return t >> (sizeof(value_type) * 8 - 1) == 0 ? t : xR;
+			if constexpr (strict) {
+				return xR >= _m - yR ? xR - (_m - yR) : xR + yR;
+			}
+			else {
+				xR += yR;
+				value_type t{xR - _mDouble};
+				return t >> (sizeof(value_type) * 8 - 1) == 0 ? t : xR;
+			}
 		}
 
 		constexpr value_type subtract(value_type xR, value_type yR) const noexcept {
-			xR -= yR;
-			return xR >> (sizeof(value_type) * 8 - 1) == 0 ? xR : xR + _mDouble;
+			if constexpr (strict) {
+				return xR >= yR ? xR - yR : xR - yR + _m;
+			}
+			else {
+				xR -= yR;
+				return xR >> (sizeof(value_type) * 8 - 1) == 0 ? xR : xR + _mDouble;
+			}
 		}
 
 		constexpr value_type multiply(value_type xR, value_type yR) const noexcept {
 			return _reduce(_double{xR} *yR);
 		}
 
+		constexpr value_type multiply(value_type xR, const constant_type& y) const noexcept {
+			if constexpr (strict) {
+				value_type q{(value_type)(_double{xR} * y.quotient() >> (sizeof(value_type) * 8))};
+				_double res{_double{xR} * y.value() - _double{q} * _m};
+				return (value_type)(res >= _m ? res - _m : res);
+			}
+			else {
+				return y.multiply(xR, _m);
+			}
+		}
+
+		constexpr constant_type prepare(value_type yR) const noexcept {
+			return constant_type{to(yR), _m};
+		}
+
 		constexpr value_type divide(value_type xR, value_type yR) const noexcept {
 			return power_multiply(yR, _m - 2, xR);
 		}
@@ -122,14 +197,218 @@ namespace concrete {
 	template<class T>
 	explicit modular_arithmetic(T)->modular_arithmetic<T>;
 
+	template<class T, ::std::size_t k, ::concrete::make_unsigned_t<T> c>
+	class pseudo_mersenne_arithmetic {
+		static_assert(::concrete::is_integral_v<T>, "T should be an integral type.");
+
+	public:
+		using value_type = ::concrete::make_unsigned_t<T>;
+		using double_type = ::concrete::unsigned_integral_t<sizeof(value_type) * 2>;
+		using constant_type = ::concrete::modular_constant<value_type>;
+
+		static_assert(k < sizeof(value_type) * 8 && c != 0 && c < value_type{1} << (k / 2 - 1),
+			"2 ^ k - c should be less than 2 ^ (sizeof(T) * 8 - 1), and c should be less than 2 ^ (k / 2 - 1).");
+
+	private:
+		using _double = double_type;
+
+		static constexpr value_type _m{(value_type{1} << k) - c};
+		static constexpr value_type _mask{(value_type{1} << k) - 1};
+
+		static constexpr _double _fold(_double x) noexcept {
+			return (x & _mask) + (x >> k) * c;
+		}
+
+		static constexpr value_type _normalize(value_type x) noexcept {
+			return x >= _m ? x - _m : x;
+		}
+
+	public:
+		constexpr pseudo_mersenne_arithmetic() noexcept = default;
+
+		explicit constexpr pseudo_mersenne_arithmetic(value_type) noexcept {}
+
+		constexpr value_type modulo() const noexcept {
+			return _m;
+		}
+
+		constexpr value_type reduce(double_type x) const noexcept {
+			while (x >> k != 0) {
+				x = _fold(x);
+			}
+			return _normalize((value_type)x);
+		}
+
+		constexpr value_type operator()(value_type x) const noexcept {
+			return reduce(x);
+		}
+
+		constexpr value_type to(value_type xR) const noexcept {
+			return xR;
+		}
+
+		constexpr bool equal(value_type xR, value_type yR) const noexcept {
+			return xR == yR;
+		}
+
+		constexpr bool not_equal(value_type xR, value_type yR) const noexcept {
+			return xR != yR;
+		}
+
+		constexpr bool less(value_type xR, value_type yR) const noexcept {
+			return xR < yR;
+		}
+
+		constexpr bool less_equal(value_type xR, value_type yR) const noexcept {
+			return xR <= yR;
+		}
+
+		constexpr bool greater(value_type xR, value_type yR) const noexcept {
+			return xR > yR;
+		}
+
+		constexpr bool greater_equal(value_type xR, value_type yR) const noexcept {
+			return xR >= yR;
+		}
+
+		constexpr value_type negate(value_type xR) const noexcept {
+			return xR == 0 ? 0 : _m - xR;
+		}
+
+		constexpr value_type add(value_type xR, value_type yR) const noexcept {
+			return _normalize(xR + yR);
+		}
+
+		constexpr value_type subtract(value_type xR, value_type yR) const noexcept {
+			xR -= yR;
+			return xR + (_m & (value_type{0} - (xR >> (sizeof(value_type) * 8 - 1))));
+		}
+
+		constexpr value_type multiply(value_type xR, value_type yR) const noexcept {
+			_double p{_double{xR} * yR};
+			value_type low{(value_type)p & _mask}, high{(value_type)(p >> k)};
+			if constexpr (c == 1) {
+				return _normalize(low + high);
+			}
+			else {
+				_double t{_double{high} * c + low};
+				return _normalize(((value_type)t & _mask) + (value_type)(t >> k) * c);
+			}
+		}
+
+		constexpr value_type multiply(value_type xR, const constant_type& y) const noexcept {
+			return _normalize(y.multiply(xR, _m));
+		}
+
+		constexpr constant_type prepare(value_type yR) const noexcept {
+			return constant_type{yR, _m};
+		}
+
+		constexpr value_type divide(value_type xR, value_type yR) const noexcept {
+			return power_multiply(yR, _m - 2, xR);
+		}
+
+		constexpr value_type power_multiply(value_type xR, value_type y, value_type zR) const noexcept {
+			while (y != 0) {
+				if (y & 1) {
+					zR = multiply(zR, xR);
+				}
+				xR = multiply(xR, xR);
+				y >>= 1;
+			}
+			return zR;
+		}
+
+		constexpr value_type power(value_type xR, value_type y) const noexcept {
+			return power_multiply(xR, y, 1);
+		}
+
+		constexpr value_type inverse(value_type xR) const noexcept {
+			return power_multiply(xR, _m - 2, 1);
+		}
+	};
+
+	template<class T, ::std::size_t k>
+	using mersenne_arithmetic = ::concrete::pseudo_mersenne_arithmetic<T, k, 1>;
+
+	namespace detail {
+
+		namespace modular {
+
+			template<auto m>
+			constexpr ::std::size_t width() noexcept {
+				::std::size_t res{0};
+				while (res != sizeof(m) * 8 && m >> res != 0) {
+					++res;
+				}
+				return res;
+			}
+
+			template<auto m, ::std::size_t k = ::concrete::detail::modular::width<m>()>
+			constexpr bool is_pseudo_mersenne() noexcept {
+				using value_type = ::concrete::make_unsigned_t<decltype(m)>;
+				if constexpr (k < 4 || k >= sizeof(value_type) * 8) {
+					return false;
+				}
+				else {
+					return m % 2 != 0 && (value_type{1} << k) - (value_type)m < value_type{1} << (k / 2 - 1);
+				}
+			}
+
+			template<auto m>
+			constexpr bool is_montgomery() noexcept {
+				return m % 2 != 0 && m >> (sizeof(m) * 8 - 2) == 0;
+			}
+
+			template<auto m>
+			constexpr bool is_special() noexcept {
+				return ::concrete::detail::modular::is_pseudo_mersenne<m>() && (!::concrete::detail::modular::is_montgomery<m>() || (m & (m + 1)) == 0);
+			}
+
+			template<auto m, bool special = ::concrete::detail::modular::is_special<m>()>
+			struct arithmetic {
+				using type = ::concrete::modular_arithmetic<::concrete::make_unsigned_t<decltype(m)>>;
+			};
+
+			template<auto m>
+			struct arithmetic<m, true> {
+				using value_type = ::concrete::make_unsigned_t<decltype(m)>;
+				static constexpr ::std::size_t k{::concrete::detail::modular::width<m>()};
+
+				using type = ::concrete::pseudo_mersenne_arithmetic<value_type, k, (value_type)((value_type{1} << k) - (value_type)m)>;
+			};
+
+		}
+
+	}
+
+	template<auto m>
+	class int_m_constant {
+	public:
+		using modular_constant_type = typename ::concrete::detail::modular::arithmetic<m>::type::constant_type;
+
+	private:
+		modular_constant_type _constant;
+
+	public:
+		constexpr int_m_constant() noexcept : _constant{} {}
+
+		explicit constexpr int_m_constant(const modular_constant_type& constant) noexcept : _constant{constant} {}
+
+		constexpr const modular_constant_type& raw() const noexcept {
+			return _constant;
+		}
+	};
+
 	template<auto m>
 	class int_m {
-		static_assert(::concrete::is_integral_v<decltype(m)>&& m % 2 != 0 && m >> (sizeof(m) * 8 - 2) == 0,
-			"m should be an odd number less than 2 ^ (sizeof(m) * 8 - 2).");
+		static_assert(::concrete::is_integral_v<decltype(m)> && (::concrete::detail::modular::is_montgomery<m>() || ::concrete::detail::modular::is_pseudo_mersenne<m>()),
+			"m should be an odd number less than 2 ^ (sizeof(m) * 8 - 2), or an odd number of the form 2 ^ k - c with a small c.");
 
 	public:
 		using value_type = ::concrete::make_unsigned_t<decltype(m)>;
-		using modular_arithmetic_type = ::concrete::modular_arithmetic<value_type>;
+		using modular_arithmetic_type = typename ::concrete::detail::modular::arithmetic<m>::type;
+		using constant_type = ::concrete::int_m_constant<m>;
 
 	private:
 		static constexpr modular_arithmetic_type _mod{m};
@@ -137,9 +416,7 @@ namespace concrete {
 		value_type _value;
 
 	public:
-		constexpr int_m(value_type value = 0) noexcept {
-			_value = _mod(value);
-		}
+		constexpr int_m(value_type value = 0) noexcept : _value{_mod(value)} {}
 
 		explicit constexpr operator value_type() const noexcept {
 			return _mod.to(_value);
@@ -201,6 +478,11 @@ namespace concrete {
 			return *this;
 		}
 
+		constexpr int_m& operator*=(const constant_type& x) noexcept {
+			_value = _mod.multiply(_value, x.raw());
+			return *this;
+		}
+
 		constexpr int_m& operator/=(int_m x) noexcept {
 			_value = _mod.divide(_value, x._value);
 			return *this;
@@ -226,11 +508,24 @@ namespace concrete {
 			return int_m{*this} *= x;
 		}
 
+		constexpr int_m operator*(const constant_type& x) const noexcept {
+			return int_m{*this} *= x;
+		}
+
 		constexpr int_m operator/(int_m x) const noexcept {
 			return int_m{*this} /= x;
 		}
 	};
 
+	template<class T>
+	struct is_int_m : ::std::false_type {};
+
+	template<auto m>
+	struct is_int_m<::concrete::int_m<m>> : ::std::true_type {};
+
+	template<class T>
+	constexpr bool is_int_m_v{::concrete::is_int_m<T>::value};
+
 	template<auto m>
 	constexpr int_m<m> operator+(typename int_m<m>::value_type value, int_m<m> x) noexcept {
 		return int_m<m>{value} += x;
@@ -246,11 +541,21 @@ namespace concrete {
 		return int_m<m>{value} *= x;
 	}
 
+	template<auto m>
+	constexpr int_m<m> operator*(const int_m_constant<m>& x, int_m<m> y) noexcept {
+		return y *= x;
+	}
+
 	template<auto m>
 	constexpr int_m<m> operator/(typename int_m<m>::value_type value, int_m<m> x) noexcept {
 		return int_m<m>{value} /= x;
 	}
 
+	template<auto m>
+	constexpr int_m_constant<m> prepare(int_m<m> x) noexcept {
+		return int_m_constant<m>{x.modular_arithmetic().prepare(x.raw())};
+	}
+
 	template<auto m>
 	constexpr int_m<m> power(int_m<m> x, typename int_m<m>::value_type value) noexcept {
 		x.raw(x.modular_arithmetic().power(x.raw(), value));
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "standard.h"
+
 #include <cstdint>
 #include <climits>
 #include <limits>
@@ -7,6 +9,9 @@
 
 #ifdef _MSC_VER
 #include <__msvc_int128.hpp>
+#include <intrin.h>
+#elif defined(__x86_64__)
+#include <x86intrin.h>
 #endif
 
 #if CHAR_BIT != 8
@@ -33,6 +38,492 @@ namespace concrete {
 	using uint128_t = unsigned __int128;
 #endif
 
+	namespace detail {
+
+		namespace wide {
+
+			template<class T>
+			constexpr bool is_builtin_v{(::std::is_integral_v<T> && !::std::is_same_v<T, bool>) || ::std::is_same_v<T, ::concrete::int128_t> || ::std::is_same_v<T, ::concrete::uint128_t>};
+
+			constexpr unsigned char add_carry(unsigned char carry, ::concrete::uint64_t x, ::concrete::uint64_t y, ::concrete::uint64_t& res) noexcept {
+#if defined(_M_X64) || defined(__x86_64__)
+				if (!::concrete::is_constant_evaluated()) {
+					unsigned long long t{};
+					carry = _addcarry_u64(carry, x, y, &t);
+					res = t;
+					return carry;
+				}
+#endif
+				::concrete::uint64_t t{x + carry};
+				res = t + y;
+				return (t < x) | (res < y);
+			}
+
+			constexpr unsigned char subtract_borrow(unsigned char borrow, ::concrete::uint64_t x, ::concrete::uint64_t y, ::concrete::uint64_t& res) noexcept {
+#if defined(_M_X64) || defined(__x86_64__)
+				if (!::concrete::is_constant_evaluated()) {
+					unsigned long long t{};
+					borrow = _subborrow_u64(borrow, x, y, &t);
+					res = t;
+					return borrow;
+				}
+#endif
+				::concrete::uint64_t t{x - borrow};
+				res = t - y;
+				return (x < borrow) | (t < y);
+			}
+
+			constexpr ::concrete::uint64_t multiply(::concrete::uint64_t x, ::concrete::uint64_t y, ::concrete::uint64_t& high) noexcept {
+				if (!::concrete::is_constant_evaluated()) {
+#if defined(_M_X64)
+					unsigned long long h{};
+					::concrete::uint64_t res{_umul128(x, y, &h)};
+					high = h;
+					return res;
+#elif defined(_MSC_VER)
+					high = __umulh(x, y);
+					return x * y;
+#else
+					::concrete::uint128_t t{(::concrete::uint128_t)x * y};
+					high = (::concrete::uint64_t)(t >> 64);
+					return (::concrete::uint64_t)t;
+#endif
+				}
+				constexpr ::concrete::uint64_t mask{0xffffffff};
+				::concrete::uint64_t ll{(x & mask) * (y & mask)}, lh{(x & mask) * (y >> 32)};
+				::concrete::uint64_t hl{(x >> 32) * (y & mask)}, hh{(x >> 32) * (y >> 32)};
+				::concrete::uint64_t mid{(ll >> 32) + (lh & mask) + (hl & mask)};
+				high = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+				return mid << 32 | (ll & mask);
+			}
+
+#if !defined(_MSC_VER) && defined(__x86_64__)
+			inline ::concrete::uint64_t divide_native(::concrete::uint64_t high, ::concrete::uint64_t low, ::concrete::uint64_t y, ::concrete::uint64_t& rem) noexcept {
+				::concrete::uint64_t res;
+				__asm__("divq %4" : "=a"(res), "=d"(rem) : "a"(low), "d"(high), "rm"(y));
+				return res;
+			}
+#endif
+
+			constexpr ::concrete::uint64_t divide(::concrete::uint64_t high, ::concrete::uint64_t low, ::concrete::uint64_t y, ::concrete::uint64_t& rem) noexcept {
+				if (!::concrete::is_constant_evaluated()) {
+#if defined(_M_X64)
+					unsigned long long r{};
+					::concrete::uint64_t res{_udiv128(high, low, y, &r)};
+					rem = r;
+					return res;
+#elif defined(__x86_64__)
+					return ::concrete::detail::wide::divide_native(high, low, y, rem);
+#endif
+				}
+				::concrete::uint64_t res{0};
+				for (int i{63}; i >= 0; --i) {
+					bool top{(high >> 63) != 0};
+					high = high << 1 | low >> 63;
+					low <<= 1;
+					if (top || high >= y) {
+						high -= y;
+						res |= (::concrete::uint64_t)1 << i;
+					}
+				}
+				rem = high;
+				return res;
+			}
+
+		}
+
+	}
+
+	template<bool is_signed, ::std::size_t size>
+	class wide_integer {
+		static_assert(size >= 16 && size % 8 == 0, "size should be a multiple of 8 not less than 16.");
+
+		template<bool, ::std::size_t>
+		friend class wide_integer;
+
+		using _unsigned = ::concrete::wide_integer<false, size>;
+
+		static constexpr ::std::size_t _count{size / 8};
+
+		::concrete::uint64_t _data[_count];
+
+		constexpr bool _negative() const noexcept {
+			return is_signed && _data[_count - 1] >> 63 != 0;
+		}
+
+		constexpr int _bit_width() const noexcept {
+			for (::std::size_t i{_count}; i-- != 0;) {
+				if (_data[i] != 0) {
+					return (int)(i * 64) + 64 - ::concrete::countl_zero(_data[i]);
+				}
+			}
+			return 0;
+		}
+
+		constexpr ::concrete::uint64_t _divide_word(::concrete::uint64_t y) noexcept {
+			::concrete::uint64_t rem{0};
+			for (::std::size_t i{_count}; i-- != 0;) {
+				_data[i] = ::concrete::detail::wide::divide(rem, _data[i], y, rem);
+			}
+			return rem;
+		}
+
+		static constexpr void _divide(const _unsigned& x, const _unsigned& y, _unsigned& quotient, _unsigned& remainder) noexcept {
+			if (y._bit_width() <= 64) {
+				quotient = x;
+				remainder = quotient._divide_word(y._data[0]);
+				return;
+			}
+			quotient = 0;
+			remainder = 0;
+			::std::size_t n{(::std::size_t)(x._bit_width() + 63) / 64}, m{(::std::size_t)(y._bit_width() + 63) / 64};
+			if (n < m) {
+				remainder = x;
+				return;
+			}
+			unsigned shift{(unsigned)::concrete::countl_zero(y._data[m - 1])};
+			::concrete::uint64_t a[_count + 1]{}, b[_count]{};
+			for (::std::size_t i{0}; i != m; ++i) {
+				b[i] = y._data[i] << shift | (shift != 0 && i != 0 ? y._data[i - 1] >> (64 - shift) : 0);
+			}
+			for (::std::size_t i{0}; i != n + 1; ++i) {
+				::concrete::uint64_t v{i != n ? x._data[i] << shift : 0};
+				a[i] = v | (shift != 0 && i != 0 ? x._data[i - 1] >> (64 - shift) : 0);
+			}
+			for (::std::size_t j{n - m + 1}; j-- != 0;) {
+				::concrete::uint64_t q{}, r{};
+				bool overflow{false};
+				if (a[j + m] >= b[m - 1]) {
+					q = ~(::concrete::uint64_t)0;
+					overflow = ::concrete::detail::wide::add_carry(0, a[j + m - 1], b[m - 1], r) != 0;
+				}
+				else {
+					q = ::concrete::detail::wide::divide(a[j + m], a[j + m - 1], b[m - 1], r);
+				}
+				while (!overflow) {
+					::concrete::uint64_t high{}, low{::concrete::detail::wide::multiply(q, b[m - 2], high)};
+					if (high < r || (high == r && low <= a[j + m - 2])) {
+						break;
+					}
+					--q;
+					overflow = ::concrete::detail::wide::add_carry(0, r, b[m - 1], r) != 0;
+				}
+				::concrete::uint64_t carry{0};
+				unsigned char borrow{0};
+				for (::std::size_t i{0}; i != m; ++i) {
+					::concrete::uint64_t high{}, low{::concrete::detail::wide::multiply(q, b[i], high)};
+					high += ::concrete::detail::wide::add_carry(0, low, carry, low);
+					carry = high;
+					borrow = ::concrete::detail::wide::subtract_borrow(borrow, a[i + j], low, a[i + j]);
+				}
+				borrow = ::concrete::detail::wide::subtract_borrow(borrow, a[j + m], carry, a[j + m]);
+				if (borrow != 0) {
+					--q;
+					unsigned char back{0};
+					for (::std::size_t i{0}; i != m; ++i) {
+						back = ::concrete::detail::wide::add_carry(back, a[i + j], b[i], a[i + j]);
+					}
+					a[j + m] += back;
+				}
+				quotient._data[j] = q;
+			}
+			for (::std::size_t i{0}; i != m; ++i) {
+				remainder._data[i] = a[i] >> shift | (shift != 0 ? a[i + 1] << (64 - shift) : 0);
+			}
+		}
+
+		static constexpr _unsigned _magnitude(const wide_integer& x) noexcept {
+			return _unsigned{x._negative() ? -x : x};
+		}
+
+	public:
+		constexpr wide_integer() noexcept : _data{} {}
+
+		template<class T, ::std::enable_if_t<::concrete::detail::wide::is_builtin_v<T>, int> = 0>
+		constexpr wide_integer(T x) noexcept : _data{} {
+			_data[0] = (::concrete::uint64_t)x;
+			::std::size_t i{1};
+			if constexpr (sizeof(T) > 8) {
+				_data[i++] = (::concrete::uint64_t)(x >> 64);
+			}
+			if constexpr (::std::numeric_limits<T>::is_signed || ::std::is_same_v<T, ::concrete::int128_t>) {
+				if (x < 0) {
+					for (; i != _count; ++i) {
+						_data[i] = ~(::concrete::uint64_t)0;
+					}
+				}
+			}
+		}
+
+		template<bool is_signed_, ::std::size_t size_>
+		explicit constexpr wide_integer(const ::concrete::wide_integer<is_signed_, size_>& x) noexcept : _data{} {
+			::concrete::uint64_t fill{x._negative() ? ~(::concrete::uint64_t)0 : 0};
+			for (::std::size_t i{0}; i != _count; ++i) {
+				_data[i] = i < x._count ? x._data[i] : fill;
+			}
+		}
+
+		template<class T, ::std::enable_if_t<::concrete::detail::wide::is_builtin_v<T>, int> = 0>
+		explicit constexpr operator T() const noexcept {
+			if constexpr (sizeof(T) > 8) {
+				return (T)((::concrete::uint128_t)_data[1] << 64 | _data[0]);
+			}
+			else {
+				return (T)_data[0];
+			}
+		}
+
+		explicit constexpr operator bool() const noexcept {
+			for (::concrete::uint64_t x : _data) {
+				if (x != 0) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		constexpr ::concrete::uint64_t* data() noexcept {
+			return _data;
+		}
+
+		constexpr const ::concrete::uint64_t* data() const noexcept {
+			return _data;
+		}
+
+		constexpr wide_integer& operator+=(const wide_integer& x) noexcept {
+			unsigned char carry{0};
+			for (::std::size_t i{0}; i != _count; ++i) {
+				carry = ::concrete::detail::wide::add_carry(carry, _data[i], x._data[i], _data[i]);
+			}
+			return *this;
+		}
+
+		constexpr wide_integer& operator-=(const wide_integer& x) noexcept {
+			unsigned char borrow{0};
+			for (::std::size_t i{0}; i != _count; ++i) {
+				borrow = ::concrete::detail::wide::subtract_borrow(borrow, _data[i], x._data[i], _data[i]);
+			}
+			return *this;
+		}
+
+		constexpr wide_integer& operator*=(const wide_integer& x) noexcept {
+			::std::size_t count{_count};
+			while (count != 0 && x._data[count - 1] == 0) {
+				--count;
+			}
+			wide_integer res;
+			for (::std::size_t i{0}; i != _count; ++i) {
+				if (_data[i] == 0) {
+					continue;
+				}
+				::concrete::uint64_t carry{0};
+				::std::size_t j{0};
+				for (; j != count && i + j != _count; ++j) {
+					::concrete::uint64_t high{}, low{::concrete::detail::wide::multiply(_data[i], x._data[j], high)};
+					high += ::concrete::detail::wide::add_carry(0, res._data[i + j], low, res._data[i + j]);
+					high += ::concrete::detail::wide::add_carry(0, res._data[i + j], carry, res._data[i + j]);
+					carry = high;
+				}
+				if (i + j != _count) {
+					res._data[i + j] = carry;
+				}
+			}
+			return *this = res;
+		}
+
+		constexpr wide_integer& operator/=(const wide_integer& x) noexcept {
+			_unsigned quotient, remainder;
+			_divide(_magnitude(*this), _magnitude(x), quotient, remainder);
+			bool negative{_negative() != x._negative()};
+			*this = wide_integer{quotient};
+			return negative ? negate() : *this;
+		}
+
+		constexpr wide_integer& operator%=(const wide_integer& x) noexcept {
+			_unsigned quotient, remainder;
+			_divide(_magnitude(*this), _magnitude(x), quotient, remainder);
+			bool negative{_negative()};
+			*this = wide_integer{remainder};
+			return negative ? negate() : *this;
+		}
+
+		constexpr wide_integer& operator&=(const wide_integer& x) noexcept {
+			for (::std::size_t i{0}; i != _count; ++i) {
+				_data[i] &= x._data[i];
+			}
+			return *this;
+		}
+
+		constexpr wide_integer& operator|=(const wide_integer& x) noexcept {
+			for (::std::size_t i{0}; i != _count; ++i) {
+				_data[i] |= x._data[i];
+			}
+			return *this;
+		}
+
+		constexpr wide_integer& operator^=(const wide_integer& x) noexcept {
+			for (::std::size_t i{0}; i != _count; ++i) {
+				_data[i] ^= x._data[i];
+			}
+			return *this;
+		}
+
+		constexpr wide_integer& operator<<=(unsigned n) noexcept {
+			::std::size_t shift{n / 64};
+			unsigned bit{n % 64};
+			for (::std::size_t i{_count}; i-- != 0;) {
+				::concrete::uint64_t x{i >= shift ? _data[i - shift] << bit : 0};
+				if (bit != 0 && i > shift) {
+					x |= _data[i - shift - 1] >> (64 - bit);
+				}
+				_data[i] = x;
+			}
+			return *this;
+		}
+
+		constexpr wide_integer& operator>>=(unsigned n) noexcept {
+			::concrete::uint64_t fill{_negative() ? ~(::concrete::uint64_t)0 : 0};
+			::std::size_t shift{n / 64};
+			unsigned bit{n % 64};
+			for (::std::size_t i{0}; i != _count; ++i) {
+				::concrete::uint64_t low{i + shift < _count ? _data[i + shift] : fill};
+				::concrete::uint64_t high{i + shift + 1 < _count ? _data[i + shift + 1] : fill};
+				_data[i] = bit == 0 ? low : low >> bit | high << (64 - bit);
+			}
+			return *this;
+		}
+
+		constexpr wide_integer& negate() noexcept {
+			unsigned char borrow{0};
+			for (::std::size_t i{0}; i != _count; ++i) {
+				borrow = ::concrete::detail::wide::subtract_borrow(borrow, 0, _data[i], _data[i]);
+			}
+			return *this;
+		}
+
+		constexpr wide_integer& operator++() noexcept {
+			return *this += 1;
+		}
+
+		constexpr wide_integer& operator--() noexcept {
+			return *this -= 1;
+		}
+
+		constexpr wide_integer operator++(int) noexcept {
+			wide_integer res{*this};
+			++*this;
+			return res;
+		}
+
+		constexpr wide_integer operator--(int) noexcept {
+			wide_integer res{*this};
+			--*this;
+			return res;
+		}
+
+		constexpr wide_integer operator+() const noexcept {
+			return *this;
+		}
+
+		constexpr wide_integer operator-() const noexcept {
+			return wide_integer{*this}.negate();
+		}
+
+		constexpr wide_integer operator~() const noexcept {
+			wide_integer res;
+			for (::std::size_t i{0}; i != _count; ++i) {
+				res._data[i] = ~_data[i];
+			}
+			return res;
+		}
+
+		constexpr bool operator!() const noexcept {
+			return !static_cast<bool>(*this);
+		}
+
+		friend constexpr wide_integer operator+(wide_integer x, const wide_integer& y) noexcept {
+			return x += y;
+		}
+
+		friend constexpr wide_integer operator-(wide_integer x, const wide_integer& y) noexcept {
+			return x -= y;
+		}
+
+		friend constexpr wide_integer operator*(wide_integer x, const wide_integer& y) noexcept {
+			return x *= y;
+		}
+
+		friend constexpr wide_integer operator/(wide_integer x, const wide_integer& y) noexcept {
+			return x /= y;
+		}
+
+		friend constexpr wide_integer operator%(wide_integer x, const wide_integer& y) noexcept {
+			return x %= y;
+		}
+
+		friend constexpr wide_integer operator&(wide_integer x, const wide_integer& y) noexcept {
+			return x &= y;
+		}
+
+		friend constexpr wide_integer operator|(wide_integer x, const wide_integer& y) noexcept {
+			return x |= y;
+		}
+
+		friend constexpr wide_integer operator^(wide_integer x, const wide_integer& y) noexcept {
+			return x ^= y;
+		}
+
+		friend constexpr wide_integer operator<<(wide_integer x, unsigned n) noexcept {
+			return x <<= n;
+		}
+
+		friend constexpr wide_integer operator>>(wide_integer x, unsigned n) noexcept {
+			return x >>= n;
+		}
+
+		friend constexpr bool operator==(const wide_integer& x, const wide_integer& y) noexcept {
+			for (::std::size_t i{0}; i != _count; ++i) {
+				if (x._data[i] != y._data[i]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		friend constexpr bool operator!=(const wide_integer& x, const wide_integer& y) noexcept {
+			return !(x == y);
+		}
+
+		friend constexpr bool operator<(const wide_integer& x, const wide_integer& y) noexcept {
+			if (x._negative() != y._negative()) {
+				return x._negative();
+			}
+			for (::std::size_t i{_count}; i-- != 0;) {
+				if (x._data[i] != y._data[i]) {
+					return x._data[i] < y._data[i];
+				}
+			}
+			return false;
+		}
+
+		friend constexpr bool operator>(const wide_integer& x, const wide_integer& y) noexcept {
+			return y < x;
+		}
+
+		friend constexpr bool operator<=(const wide_integer& x, const wide_integer& y) noexcept {
+			return !(y < x);
+		}
+
+		friend constexpr bool operator>=(const wide_integer& x, const wide_integer& y) noexcept {
+			return !(x < y);
+		}
+	};
+
+	using int256_t = ::concrete::wide_integer<true, 32>;
+	using uint256_t = ::concrete::wide_integer<false, 32>;
+	using int512_t = ::concrete::wide_integer<true, 64>;
+	using uint512_t = ::concrete::wide_integer<false, 64>;
+
 	template<bool is_signed, ::std::size_t size>
 	struct integral {};
 
@@ -61,6 +552,16 @@ namespace concrete {
 		using type = ::concrete::int128_t;
 	};
 
+	template<>
+	struct integral<true, 32> {
+		using type = ::concrete::int256_t;
+	};
+
+	template<>
+	struct integral<true, 64> {
+		using type = ::concrete::int512_t;
+	};
+
 	template<>
 	struct integral<false, 1> {
 		using type = ::concrete::uint8_t;
@@ -86,6 +587,16 @@ namespace concrete {
 		using type = ::concrete::uint128_t;
 	};
 
+	template<>
+	struct integral<false, 32> {
+		using type = ::concrete::uint256_t;
+	};
+
+	template<>
+	struct integral<false, 64> {
+		using type = ::concrete::uint512_t;
+	};
+
 	template<::std::size_t size>
 	using signed_integral = ::concrete::integral<true, size>;
 
@@ -139,4 +650,74 @@ namespace concrete {
 	template<class T>
 	using make_unsigned_t = typename ::concrete::make_unsigned<T>::type;
 
+}
+
+namespace std {
+
+	template<bool is_signed_, ::std::size_t size>
+	class numeric_limits<::concrete::wide_integer<is_signed_, size>> {
+		using type = ::concrete::wide_integer<is_signed_, size>;
+
+	public:
+		static constexpr bool is_specialized{true};
+		static constexpr bool is_signed{is_signed_};
+		static constexpr bool is_integer{true};
+		static constexpr bool is_exact{true};
+		static constexpr bool has_infinity{false};
+		static constexpr bool has_quiet_NaN{false};
+		static constexpr bool has_signaling_NaN{false};
+		static constexpr ::std::float_denorm_style has_denorm{::std::denorm_absent};
+		static constexpr bool has_denorm_loss{false};
+		static constexpr ::std::float_round_style round_style{::std::round_toward_zero};
+		static constexpr bool is_iec559{false};
+		static constexpr bool is_bounded{true};
+		static constexpr bool is_modulo{!is_signed_};
+		static constexpr int digits{(int)(size * 8) - is_signed_};
+		static constexpr int digits10{digits * 643 / 2136};
+		static constexpr int max_digits10{0};
+		static constexpr int radix{2};
+		static constexpr int min_exponent{0};
+		static constexpr int min_exponent10{0};
+		static constexpr int max_exponent{0};
+		static constexpr int max_exponent10{0};
+		static constexpr bool traps{::std::numeric_limits<::concrete::uint64_t>::traps};
+		static constexpr bool tinyness_before{false};
+
+		static constexpr type min() noexcept {
+			return is_signed_ ? type{1} << (unsigned)(size * 8 - 1) : type{};
+		}
+
+		static constexpr type lowest() noexcept {
+			return min();
+		}
+
+		static constexpr type max() noexcept {
+			return ~min();
+		}
+
+		static constexpr type epsilon() noexcept {
+			return type{};
+		}
+
+		static constexpr type round_error() noexcept {
+			return type{};
+		}
+
+		static constexpr type infinity() noexcept {
+			return type{};
+		}
+
+		static constexpr type quiet_NaN() noexcept {
+			return type{};
+		}
+
+		static constexpr type signaling_NaN() noexcept {
+			return type{};
+		}
+
+		static constexpr type denorm_min() noexcept {
+			return type{};
+		}
+	};
+
 }
\ No newline at end of file
@@ -0,0 +1,247 @@
+#pragma once
+
+#include "convolution.h"
+#include "integral.h"
+#include "standard.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace concrete {
+
+	template<class T>
+	::std::vector<T> berlekamp_massey(const ::std::vector<T>& terms) {
+		::std::vector<T> c{T{1}}, b{T{1}};
+		T last{1};
+		::std::size_t length{0}, shift{1};
+		for (::std::size_t n{0}; n != terms.size(); ++n) {
+			T d{terms[n]};
+			for (::std::size_t i{1}; i <= length; ++i) {
+				d += c[i] * terms[n - i];
+			}
+			if (d == T{0}) {
+				++shift;
+				continue;
+			}
+			bool grow{2 * length <= n};
+			::std::vector<T> t;
+			if (grow) {
+				t = c;
+			}
+			T coef{d / last};
+			if (c.size() < b.size() + shift) {
+				c.resize(b.size() + shift);
+			}
+			for (::std::size_t i{0}; i != b.size(); ++i) {
+				c[i + shift] -= coef * b[i];
+			}
+			if (grow) {
+				length = n + 1 - length;
+				b = ::std::move(t);
+				last = d;
+				shift = 1;
+			}
+			else {
+				++shift;
+			}
+			c.resize(length + 1);
+		}
+		::std::vector<T> res(length);
+		for (::std::size_t i{0}; i != length; ++i) {
+			res[i] = -c[i + 1];
+		}
+		return res;
+	}
+
+	template<class T>
+	class linear_recurrence {
+		::std::vector<T> _terms, _coefficients, _low, _inverse;
+		::std::size_t _size;
+		bool _fast;
+
+		static ::std::vector<T> _truncate(::std::vector<T> x, ::std::size_t size) {
+			x.resize(size);
+			return x;
+		}
+
+		static ::std::vector<T> _series_inverse(const ::std::vector<T>& x, ::std::size_t size) {
+			::std::vector<T> res{::concrete::inverse(x[0])};
+			for (::std::size_t len{1}; len < size; len <<= 1) {
+				::std::vector<T> t{::concrete::convolution(_truncate(::std::vector<T>(x.begin(), x.begin() + (::std::min)(x.size(), len << 1)), len << 1), res)};
+				t = _truncate(::std::move(t), len << 1);
+				for (T& v : t) {
+					v = -v;
+				}
+				t[0] += T{2};
+				res = _truncate(::concrete::convolution(res, t), len << 1);
+			}
+			return _truncate(::std::move(res), size);
+		}
+
+		void _transform(::std::vector<T>& x) const {
+			x.resize(_size);
+			::concrete::detail::ntt::transform(x.data(), _size);
+		}
+
+		::std::vector<T> _inverse_transform(::std::vector<T>& x, ::std::size_t size) const {
+			::concrete::detail::ntt::inverse_transform(x.data(), _size);
+			return _truncate(::std::move(x), size);
+		}
+
+		::std::vector<T> _reduce(::std::vector<T> x) const {
+			::std::size_t k{_coefficients.size()};
+			if (x.size() <= k) {
+				return _truncate(::std::move(x), k);
+			}
+			if (_fast && x.size() - k >= ::concrete::detail::ntt::naive_threshold) {
+				if constexpr (::concrete::detail::ntt::traits<T>::value) {
+					::std::size_t d{x.size() - k};
+					::std::vector<T> q(x.rbegin(), x.rbegin() + d);
+					_transform(q);
+					for (::std::size_t i{0}; i != _size; ++i) {
+						q[i] *= _inverse[i];
+					}
+					q = _inverse_transform(q, d);
+					q = ::std::vector<T>(q.rbegin(), q.rend());
+					_transform(q);
+					for (::std::size_t i{0}; i != _size; ++i) {
+						q[i] *= _low[i];
+					}
+					q = _inverse_transform(q, k);
+					for (::std::size_t i{0}; i != k; ++i) {
+						q[i] += x[i];
+					}
+					return q;
+				}
+			}
+			for (::std::size_t i{x.size() - 1}; i >= k; --i) {
+				T t{x[i]};
+				for (::std::size_t j{0}; j != k; ++j) {
+					x[i - 1 - j] += t * _coefficients[j];
+				}
+			}
+			return _truncate(::std::move(x), k);
+		}
+
+		::std::vector<T> _multiply(const ::std::vector<T>& x, const ::std::vector<T>& y) const {
+			if (_fast) {
+				if constexpr (::concrete::detail::ntt::traits<T>::value) {
+					::std::vector<T> a{x};
+					_transform(a);
+					if (&x == &y) {
+						for (::std::size_t i{0}; i != _size; ++i) {
+							a[i] *= a[i];
+						}
+					}
+					else {
+						::std::vector<T> b{y};
+						_transform(b);
+						for (::std::size_t i{0}; i != _size; ++i) {
+							a[i] *= b[i];
+						}
+					}
+					return _reduce(_inverse_transform(a, x.size() + y.size() - 1));
+				}
+			}
+			return _reduce(::concrete::detail::naive_convolution(x, y));
+		}
+
+		::std::vector<T> _shift(::std::vector<T> x) const {
+			x.insert(x.begin(), T{0});
+			return _reduce(::std::move(x));
+		}
+
+		T _evaluate(const ::std::vector<T>& x) const {
+			T res{0};
+			for (::std::size_t i{0}; i != x.size(); ++i) {
+				res += x[i] * _terms[i];
+			}
+			return res;
+		}
+
+	public:
+		explicit linear_recurrence(const ::std::vector<T>& terms) :
+			linear_recurrence(terms, ::concrete::berlekamp_massey(terms)) {}
+
+		explicit linear_recurrence(const ::std::vector<T>& terms, const ::std::vector<T>& coefficients) :
+			_terms(coefficients.size()),
+			_coefficients{coefficients},
+			_size{::concrete::bit_ceil(coefficients.size() << 1)},
+			_fast{coefficients.size() >= ::concrete::detail::ntt::naive_threshold && ::concrete::detail::ntt::is_available<T>(_size)} {
+			::std::copy_n(terms.begin(), ::std::min(terms.size(), _terms.size()), _terms.begin());
+			if (_fast) {
+				::std::size_t k{_coefficients.size()};
+				::std::vector<T> p(k + 1);
+				p[0] = T{1};
+				for (::std::size_t i{0}; i != k; ++i) {
+					p[i + 1] = -_coefficients[i];
+				}
+				_inverse = _series_inverse(p, k);
+				_transform(_inverse);
+				_low.resize(k);
+				for (::std::size_t i{0}; i != k; ++i) {
+					_low[k - 1 - i] = _coefficients[i];
+				}
+				_transform(_low);
+			}
+		}
+
+		::std::size_t order() const noexcept {
+			return _coefficients.size();
+		}
+
+		const ::std::vector<T>& coefficients() const noexcept {
+			return _coefficients;
+		}
+
+		T operator()(::concrete::uint64_t n) const {
+			::std::size_t k{_coefficients.size()};
+			if (n < k) {
+				return _terms[n];
+			}
+			if (k == 0) {
+				return T{0};
+			}
+			::std::vector<T> res{T{1}};
+			for (int i{::concrete::bit_width(n) - 1}; i >= 0; --i) {
+				res = _multiply(res, res);
+				if (n >> i & 1) {
+					res = _shift(::std::move(res));
+				}
+			}
+			return _evaluate(res);
+		}
+
+		::std::vector<T> operator()(const ::std::vector<::concrete::uint64_t>& ns) const {
+			::std::size_t k{_coefficients.size()};
+			::std::vector<T> res(ns.size());
+			if (k == 0) {
+				return res;
+			}
+			::concrete::uint64_t top{0};
+			for (::concrete::uint64_t n : ns) {
+				top |= n;
+			}
+			::std::vector<::std::vector<T>> powers{_shift({T{1}})};
+			for (int i{1}; i < ::concrete::bit_width(top); ++i) {
+				powers.push_back(_multiply(powers.back(), powers.back()));
+			}
+			for (::std::size_t t{0}; t != ns.size(); ++t) {
+				::concrete::uint64_t n{ns[t]};
+				if (n < k) {
+					res[t] = _terms[n];
+					continue;
+				}
+				::std::vector<T> p{T{1}};
+				for (int i{0}; i != ::concrete::bit_width(n); ++i) {
+					if (n >> i & 1) {
+						p = _multiply(p, powers[i]);
+					}
+				}
+				res[t] = _evaluate(p);
+			}
+			return res;
+		}
+	};
+
+}
\ No newline at end of file
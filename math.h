@@ -1,6 +1,7 @@
 #pragma once
 
 #include "int_m.h"
+#include "operator.h"
 
 #include <cmath>
 #include <initializer_list>
@@ -33,6 +34,25 @@ namespace concrete {
 
 			constexpr data_type bounds{341531, 1050535501, 350269456337, 55245642489451, 7999252175582851, 585226005592931977};
 
+			template<class Mod>
+			constexpr bool miller_rabin(const Mod& mod, ::concrete::uint64_t x, data_type bases) noexcept {
+				unsigned n{(unsigned)::concrete::countr_zero(x - 1)};
+				::concrete::uint64_t c{(x - 1) >> n};
+				for (::concrete::uint64_t b : bases) {
+					::concrete::uint64_t t{mod.power(mod(b), c)};
+					if (mod.to(t) != 1) {
+						unsigned k{0};
+						while (mod.to(t) != x - 1) {
+							t = mod.multiply(t, t);
+							if (++k == n) {
+								return false;
+							}
+						}
+					}
+				}
+				return true;
+			}
+
 		}
 
 	}
@@ -51,6 +71,9 @@ namespace concrete {
 	}
 
 	constexpr ::concrete::uint64_t power(::concrete::uint64_t x, ::concrete::uint64_t y) noexcept {
+		if (y == 0) {
+			return 1;
+		}
 		::concrete::uint64_t res{1}, tab[16]{1};
 		for (::std::size_t i{1}; i != 16; ++i) {
 			tab[i] = tab[i - 1] * x;
@@ -69,6 +92,36 @@ namespace concrete {
 		return res;
 	}
 
+	template<class T, class Op>
+	constexpr T power(const T& x, ::concrete::uint64_t y, Op op) {
+		static_assert(::concrete::is_monoid_v<Op>, "Op should be a monoid.");
+
+		T tab[16]{::concrete::algebraic_traits<Op>::identity};
+		for (::std::size_t i{1}; i != 16 && i <= y; ++i) {
+			tab[i] = op(tab[i - 1], x);
+		}
+		if (y < 16) {
+			return tab[y];
+		}
+		unsigned n{(unsigned)::concrete::countl_zero(y) & ~3};
+		y <<= n;
+		T res{tab[y >> 60]};
+		n += 4;
+		y <<= 4;
+		while (n != 64) {
+			res = op(res, res);
+			res = op(res, res);
+			res = op(res, res);
+			res = op(res, res);
+			if (y >> 60 != 0) {
+				res = op(res, tab[y >> 60]);
+			}
+			n += 4;
+			y <<= 4;
+		}
+		return res;
+	}
+
 	constexpr ::concrete::uint64_t greatest_common_divisor(::concrete::uint64_t x, ::concrete::uint64_t y) noexcept {
 		if (x == 0) {
 			return y;
@@ -161,22 +214,10 @@ namespace concrete {
 				return false;
 			}
 		}
-		::concrete::modular_arithmetic mod{x};
-		unsigned n{(unsigned)::concrete::countr_zero(x - 1)};
-		::concrete::uint64_t c{(x - 1) >> n};
-		for (::concrete::uint64_t b : bases[i]) {
-			::concrete::uint64_t t{mod.power(mod(b), c)};
-			if (mod.to(t) != 1) {
-				unsigned k{0};
-				while (mod.to(t) != x - 1) {
-					t = mod.multiply(t, t);
-					if (++k == n) {
-						return false;
-					}
-				}
-			}
+		if (x >> 62 != 0) {
+			return miller_rabin(::concrete::modular_arithmetic<::concrete::uint64_t, true>{x}, x, bases[i]);
 		}
-		return true;
+		return miller_rabin(::concrete::modular_arithmetic{x}, x, bases[i]);
 	}
 
 }
\ No newline at end of file
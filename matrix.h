@@ -0,0 +1,512 @@
+#pragma once
+
+#include "int_m.h"
+#include "math.h"
+#include "numeric.h"
+#include "operator.h"
+
+#include <initializer_list>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace concrete {
+
+	template<class T, ::std::size_t rows, ::std::size_t cols = rows>
+	class static_matrix {
+		T _data[rows][cols];
+
+		static constexpr ::std::size_t _unroll_limit{8};
+
+		template<class U>
+		static constexpr void _accumulate(U& acc, const T& x, const T& y, const U& bound) noexcept {
+			acc += U{x.raw()} * y.raw();
+			acc = acc >= bound ? acc - bound : acc;
+		}
+
+		template<::std::size_t other_cols, ::std::size_t... k>
+		static constexpr T _inner_product(const static_matrix& x, const static_matrix<T, cols, other_cols>& y, ::std::size_t i, ::std::size_t j, ::std::index_sequence<k...>) noexcept {
+			if constexpr (::concrete::is_int_m_v<T>) {
+				using double_type = typename T::modular_arithmetic_type::double_type;
+				constexpr auto& mod{T{}.modular_arithmetic()};
+				constexpr double_type bound{double_type{mod.modulo()} << (sizeof(typename T::value_type) * 8)};
+				double_type acc{0};
+				if constexpr (cols <= _unroll_limit) {
+					(_accumulate(acc, x[i][k], y[k][j], bound), ...);
+				}
+				else {
+					for (::std::size_t t{0}; t != cols; ++t) {
+						_accumulate(acc, x[i][t], y[t][j], bound);
+					}
+				}
+				T res{};
+				res.raw(mod.reduce(acc));
+				return res;
+			}
+			else {
+				T acc{};
+				if constexpr (cols <= _unroll_limit) {
+					((acc += x[i][k] * y[k][j]), ...);
+				}
+				else {
+					for (::std::size_t t{0}; t != cols; ++t) {
+						acc += x[i][t] * y[t][j];
+					}
+				}
+				return acc;
+			}
+		}
+
+	public:
+		using value_type = T;
+
+		constexpr static_matrix() noexcept : _data{} {}
+
+		explicit constexpr static_matrix(const T& scalar) noexcept : _data{} {
+			for (::std::size_t i{0}; i != rows && i != cols; ++i) {
+				_data[i][i] = scalar;
+			}
+		}
+
+		constexpr static_matrix(::std::initializer_list<::std::initializer_list<T>> list) noexcept : _data{} {
+			::std::size_t i{0};
+			for (auto& row : list) {
+				::std::size_t j{0};
+				for (auto& x : row) {
+					_data[i][j++] = x;
+				}
+				++i;
+			}
+		}
+
+		static constexpr ::std::size_t row_count() noexcept {
+			return rows;
+		}
+
+		static constexpr ::std::size_t col_count() noexcept {
+			return cols;
+		}
+
+		constexpr T* operator[](::std::size_t index) noexcept {
+			return _data[index];
+		}
+
+		constexpr const T* operator[](::std::size_t index) const noexcept {
+			return _data[index];
+		}
+
+		constexpr bool operator==(const static_matrix& x) const noexcept {
+			for (::std::size_t i{0}; i != rows; ++i) {
+				for (::std::size_t j{0}; j != cols; ++j) {
+					if (_data[i][j] != x._data[i][j]) {
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		constexpr bool operator!=(const static_matrix& x) const noexcept {
+			return !(*this == x);
+		}
+
+		constexpr static_matrix& operator+=(const static_matrix& x) noexcept {
+			for (::std::size_t i{0}; i != rows; ++i) {
+				for (::std::size_t j{0}; j != cols; ++j) {
+					_data[i][j] += x._data[i][j];
+				}
+			}
+			return *this;
+		}
+
+		constexpr static_matrix& operator-=(const static_matrix& x) noexcept {
+			for (::std::size_t i{0}; i != rows; ++i) {
+				for (::std::size_t j{0}; j != cols; ++j) {
+					_data[i][j] -= x._data[i][j];
+				}
+			}
+			return *this;
+		}
+
+		constexpr static_matrix& operator*=(const static_matrix<T, cols, cols>& x) noexcept {
+			return *this = *this * x;
+		}
+
+		constexpr static_matrix operator+(const static_matrix& x) const noexcept {
+			return static_matrix{*this} += x;
+		}
+
+		constexpr static_matrix operator-(const static_matrix& x) const noexcept {
+			return static_matrix{*this} -= x;
+		}
+
+		template<::std::size_t other_cols>
+		constexpr static_matrix<T, rows, other_cols> operator*(const static_matrix<T, cols, other_cols>& x) const noexcept {
+			static_matrix<T, rows, other_cols> res;
+			for (::std::size_t i{0}; i != rows; ++i) {
+				for (::std::size_t j{0}; j != other_cols; ++j) {
+					res[i][j] = _inner_product(*this, x, i, j, ::std::make_index_sequence<cols>{});
+				}
+			}
+			return res;
+		}
+	};
+
+	template<class T, ::std::size_t n>
+	constexpr ::concrete::static_matrix<T, n> power(const ::concrete::static_matrix<T, n>& x, ::concrete::uint64_t y) noexcept {
+		return ::concrete::power(x, y, ::concrete::multiply<::concrete::static_matrix<T, n>>{});
+	}
+
+	namespace detail {
+
+		namespace dense {
+
+			constexpr ::std::size_t block_rows{4};
+			constexpr ::std::size_t block_cols{8};
+			constexpr ::std::size_t tile_depth{256};
+			constexpr ::std::size_t tile_cols{512};
+			constexpr ::std::size_t fold_period{8};
+			constexpr ::std::size_t panel_width{64};
+
+			template<class T>
+			constexpr bool is_foldable() noexcept {
+				if constexpr (::concrete::is_int_m_v<T>) {
+					return T{}.modular_arithmetic().modulo() >> (sizeof(typename T::value_type) * 8 - 2) == 0;
+				}
+				else {
+					return false;
+				}
+			}
+
+			template<class value_type, class double_type>
+			void multiply_add_kernel(const value_type* x, const value_type* y, double_type* z,
+				::std::size_t zStride, ::std::size_t depth, double_type bound) noexcept {
+				double_type acc[block_rows][block_cols];
+				for (::std::size_t r{0}; r != block_rows; ++r) {
+					for (::std::size_t j{0}; j != block_cols; ++j) {
+						acc[r][j] = z[r * zStride + j];
+					}
+				}
+				for (::std::size_t k{0}; k != depth; ++k) {
+					for (::std::size_t r{0}; r != block_rows; ++r) {
+						for (::std::size_t j{0}; j != block_cols; ++j) {
+							acc[r][j] += double_type{x[k * block_rows + r]} * y[k * block_cols + j];
+						}
+					}
+					if ((k + 1) % fold_period == 0 || k + 1 == depth) {
+						for (::std::size_t r{0}; r != block_rows; ++r) {
+							for (::std::size_t j{0}; j != block_cols; ++j) {
+								acc[r][j] = acc[r][j] >= bound ? acc[r][j] - bound : acc[r][j];
+							}
+						}
+					}
+				}
+				for (::std::size_t r{0}; r != block_rows; ++r) {
+					for (::std::size_t j{0}; j != block_cols; ++j) {
+						z[r * zStride + j] = acc[r][j];
+					}
+				}
+			}
+
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+			template<class value_type, class double_type>
+			[[gnu::target("avx2,bmi,bmi2,lzcnt,fma"), gnu::flatten]] void multiply_add_kernel_avx2(const value_type* x, const value_type* y, double_type* z,
+				::std::size_t zStride, ::std::size_t depth, double_type bound) noexcept {
+				::concrete::detail::dense::multiply_add_kernel(x, y, z, zStride, depth, bound);
+			}
+
+			template<class value_type, class double_type>
+			[[gnu::target("avx512f,avx512dq,avx512bw,avx512vl,avx2,bmi,bmi2,lzcnt,fma"), gnu::flatten]] void multiply_add_kernel_avx512(const value_type* x, const value_type* y, double_type* z,
+				::std::size_t zStride, ::std::size_t depth, double_type bound) noexcept {
+				::concrete::detail::dense::multiply_add_kernel(x, y, z, zStride, depth, bound);
+			}
+#endif
+
+			template<class value_type, class double_type>
+			const auto& multiply_add_dispatch() {
+				static const ::concrete::dispatch<void(const value_type*, const value_type*, double_type*, ::std::size_t, ::std::size_t, double_type)> res{
+					{::concrete::isa::generic, &::concrete::detail::dense::multiply_add_kernel<value_type, double_type>},
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+					{::concrete::isa::avx2, &::concrete::detail::dense::multiply_add_kernel_avx2<value_type, double_type>},
+					{::concrete::isa::avx512, &::concrete::detail::dense::multiply_add_kernel_avx512<value_type, double_type>},
+#endif
+				};
+				return res;
+			}
+
+			template<class T>
+			void multiply_add(const T* x, const T* y, T* z,
+				::std::size_t xStride, ::std::size_t yStride, ::std::size_t zStride,
+				::std::size_t rows, ::std::size_t depth, ::std::size_t cols, bool subtract) {
+				if constexpr (::concrete::detail::dense::is_foldable<T>()) {
+					using value_type = typename T::value_type;
+					using double_type = typename T::modular_arithmetic_type::double_type;
+					const auto& mod{T{}.modular_arithmetic()};
+					const value_type m{mod.modulo()};
+					const double_type bound{double_type{m} * m * fold_period};
+					auto canonical{[m](value_type v) { return v >= m ? v - m : v; }};
+
+					::std::size_t paddedRows{(rows + block_rows - 1) / block_rows * block_rows};
+					::std::size_t paddedCols{(cols + block_cols - 1) / block_cols * block_cols};
+					::std::vector<double_type> acc(paddedRows * paddedCols);
+					auto kernel{::concrete::detail::dense::multiply_add_dispatch<value_type, double_type>().get()};
+					::std::vector<value_type> packedX(paddedRows * tile_depth), packedY(tile_depth * paddedCols);
+					for (::std::size_t kk{0}; kk < depth; kk += tile_depth) {
+						::std::size_t d{depth - kk < tile_depth ? depth - kk : tile_depth};
+						for (::std::size_t i{0}; i != paddedRows; ++i) {
+							value_type* block{packedX.data() + i / block_rows * block_rows * d + i % block_rows};
+							for (::std::size_t k{0}; k != d; ++k) {
+								block[k * block_rows] = i < rows ? canonical(x[i * xStride + kk + k].raw()) : 0;
+							}
+						}
+						for (::std::size_t k{0}; k != d; ++k) {
+							for (::std::size_t j{0}; j != paddedCols; ++j) {
+								packedY[j / block_cols * block_cols * d + k * block_cols + j % block_cols] = j < cols ? canonical(y[(kk + k) * yStride + j].raw()) : 0;
+							}
+						}
+						for (::std::size_t jj{0}; jj < paddedCols; jj += tile_cols) {
+							::std::size_t jEnd{paddedCols - jj < tile_cols ? paddedCols : jj + tile_cols};
+							for (::std::size_t i{0}; i != paddedRows; i += block_rows) {
+								for (::std::size_t j{jj}; j != jEnd; j += block_cols) {
+									kernel(packedX.data() + i * d, packedY.data() + j * d, acc.data() + i * paddedCols + j, paddedCols, d, bound);
+								}
+							}
+						}
+					}
+					for (::std::size_t i{0}; i != rows; ++i) {
+						T* zRow{z + i * zStride};
+						for (::std::size_t j{0}; j != cols; ++j) {
+							T t;
+							t.raw(mod.reduce(acc[i * paddedCols + j] % m));
+							zRow[j] = subtract ? zRow[j] - t : zRow[j] + t;
+						}
+					}
+				}
+				else {
+					for (::std::size_t i{0}; i != rows; ++i) {
+						T* zRow{z + i * zStride};
+						for (::std::size_t k{0}; k != depth; ++k) {
+							T a{x[i * xStride + k]};
+							const T* yRow{y + k * yStride};
+							for (::std::size_t j{0}; j != cols; ++j) {
+								if (subtract) {
+									zRow[j] -= a * yRow[j];
+								}
+								else {
+									zRow[j] += a * yRow[j];
+								}
+							}
+						}
+					}
+				}
+			}
+
+			template<class T>
+			::std::size_t eliminate(T* a, ::std::size_t rows, ::std::size_t cols, ::std::size_t pivotCols, T& det) {
+				::std::size_t r{0};
+				::std::vector<::std::size_t> pivots;
+				for (::std::size_t c0{0}; c0 < pivotCols && r != rows; c0 += panel_width) {
+					::std::size_t c1{pivotCols - c0 < panel_width ? pivotCols : c0 + panel_width};
+					::std::size_t r0{r};
+					pivots.clear();
+					for (::std::size_t c{c0}; c != c1 && r != rows; ++c) {
+						::std::size_t p{r};
+						while (p != rows && a[p * cols + c] == T{0}) {
+							++p;
+						}
+						if (p == rows) {
+							det = T{0};
+							continue;
+						}
+						if (p != r) {
+							for (::std::size_t j{0}; j != cols; ++j) {
+								::concrete::swap(a[p * cols + j], a[r * cols + j]);
+							}
+							det = -det;
+						}
+						T* pivotRow{a + r * cols};
+						for (::std::size_t q{0}; q != pivots.size(); ++q) {
+							T f{pivotRow[pivots[q]]};
+							const T* qRow{a + (r0 + q) * cols};
+							for (::std::size_t j{c1}; j != cols; ++j) {
+								pivotRow[j] -= f * qRow[j];
+							}
+						}
+						det *= pivotRow[c];
+						T inv{T{1} / pivotRow[c]};
+						for (::std::size_t i{r + 1}; i != rows; ++i) {
+							T* row{a + i * cols};
+							T f{row[c] * inv};
+							row[c] = f;
+							for (::std::size_t j{c + 1}; j != c1; ++j) {
+								row[j] -= f * pivotRow[j];
+							}
+						}
+						pivots.push_back(c);
+						++r;
+					}
+					if (pivots.empty() || r == rows || c1 == cols) {
+						continue;
+					}
+					::std::size_t k{pivots.size()};
+					::std::vector<T> left((rows - r) * k), right(k * (cols - c1));
+					for (::std::size_t i{r}; i != rows; ++i) {
+						for (::std::size_t q{0}; q != k; ++q) {
+							left[(i - r) * k + q] = a[i * cols + pivots[q]];
+						}
+					}
+					for (::std::size_t q{0}; q != k; ++q) {
+						for (::std::size_t j{c1}; j != cols; ++j) {
+							right[q * (cols - c1) + j - c1] = a[(r0 + q) * cols + j];
+						}
+					}
+					::concrete::detail::dense::multiply_add(left.data(), right.data(), a + r * cols + c1, k, cols - c1, cols, rows - r, k, cols - c1, true);
+				}
+				return r;
+			}
+
+		}
+
+	}
+
+	template<class T>
+	class matrix : private ::std::vector<T> {
+		using base = ::std::vector<T>;
+
+		::std::size_t _rows, _cols;
+
+	public:
+		using value_type = T;
+
+		matrix() noexcept : _rows{0}, _cols{0} {}
+
+		explicit matrix(::std::size_t rows, ::std::size_t cols, const T& value = T{}) : base(rows * cols, value), _rows{rows}, _cols{cols} {}
+
+		::std::size_t row_count() const noexcept {
+			return _rows;
+		}
+
+		::std::size_t col_count() const noexcept {
+			return _cols;
+		}
+
+		using base::data;
+
+		T* operator[](::std::size_t index) noexcept {
+			return data() + index * _cols;
+		}
+
+		const T* operator[](::std::size_t index) const noexcept {
+			return data() + index * _cols;
+		}
+
+		bool operator==(const matrix& x) const noexcept {
+			return _rows == x._rows && _cols == x._cols && static_cast<const base&>(*this) == static_cast<const base&>(x);
+		}
+
+		bool operator!=(const matrix& x) const noexcept {
+			return !(*this == x);
+		}
+
+		matrix& operator+=(const matrix& x) noexcept {
+			for (::std::size_t i{0}; i != base::size(); ++i) {
+				base::operator[](i) += x.data()[i];
+			}
+			return *this;
+		}
+
+		matrix& operator-=(const matrix& x) noexcept {
+			for (::std::size_t i{0}; i != base::size(); ++i) {
+				base::operator[](i) -= x.data()[i];
+			}
+			return *this;
+		}
+
+		matrix operator+(const matrix& x) const {
+			return matrix{*this} += x;
+		}
+
+		matrix operator-(const matrix& x) const {
+			return matrix{*this} -= x;
+		}
+
+		matrix operator*(const matrix& x) const;
+
+		matrix& operator*=(const matrix& x) {
+			return *this = *this * x;
+		}
+	};
+
+	template<class T>
+	::concrete::matrix<T> matrix_multiply(const ::concrete::matrix<T>& x, const ::concrete::matrix<T>& y, ::std::size_t threads = 1) {
+		::std::size_t rows{x.row_count()}, depth{x.col_count()}, cols{y.col_count()};
+		::concrete::matrix<T> res(rows, cols);
+		if (threads > rows / ::concrete::detail::dense::block_rows) {
+			threads = rows / ::concrete::detail::dense::block_rows;
+		}
+		if (threads <= 1) {
+			::concrete::detail::dense::multiply_add(x.data(), y.data(), res.data(), depth, cols, cols, rows, depth, cols, false);
+			return res;
+		}
+		::concrete::detail::parallel::for_each_block(rows, threads, [&](::std::size_t, ::std::size_t first, ::std::size_t last) {
+			::concrete::detail::dense::multiply_add(x[first], y.data(), res[first], depth, cols, cols, last - first, depth, cols, false);
+		});
+		return res;
+	}
+
+	template<class T>
+	::concrete::matrix<T> matrix<T>::operator*(const matrix& x) const {
+		return ::concrete::matrix_multiply(*this, x);
+	}
+
+	template<class T>
+	T determinant(::concrete::matrix<T> x) {
+		T res{1};
+		::std::size_t n{x.row_count()};
+		if (::concrete::detail::dense::eliminate(x.data(), n, n, n, res) != n) {
+			return T{0};
+		}
+		return res;
+	}
+
+	template<class T>
+	::std::size_t rank(::concrete::matrix<T> x) {
+		T det{1};
+		return ::concrete::detail::dense::eliminate(x.data(), x.row_count(), x.col_count(), x.col_count(), det);
+	}
+
+	template<class T>
+	::std::optional<::concrete::matrix<T>> inverse(const ::concrete::matrix<T>& x) {
+		::std::size_t n{x.row_count()};
+		::concrete::matrix<T> a(n, n << 1);
+		for (::std::size_t i{0}; i != n; ++i) {
+			for (::std::size_t j{0}; j != n; ++j) {
+				a[i][j] = x[i][j];
+			}
+			a[i][n + i] = T{1};
+		}
+		T det{1};
+		if (::concrete::detail::dense::eliminate(a.data(), n, n << 1, n, det) != n) {
+			return ::std::nullopt;
+		}
+		::concrete::matrix<T> b(n, n << 1);
+		for (::std::size_t i{0}; i != n; ++i) {
+			for (::std::size_t j{0}; j <= i; ++j) {
+				b[i][j] = a[n - 1 - i][n - 1 - j];
+			}
+			for (::std::size_t j{n}; j != n << 1; ++j) {
+				b[i][j] = a[n - 1 - i][j];
+			}
+		}
+		::concrete::detail::dense::eliminate(b.data(), n, n << 1, n, det);
+		::concrete::matrix<T> res(n, n);
+		for (::std::size_t i{0}; i != n; ++i) {
+			T inv{T{1} / b[i][i]};
+			for (::std::size_t j{0}; j != n; ++j) {
+				res[n - 1 - i][j] = b[i][n + j] * inv;
+			}
+		}
+		return res;
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "operator.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace parallel {
+
+			constexpr ::std::size_t grain{1 << 16};
+
+			template<class iterator>
+			constexpr bool is_random_access_v{::std::is_base_of_v<::std::random_access_iterator_tag, typename ::std::iterator_traits<iterator>::iterator_category>};
+
+			inline ::std::size_t parse(const char* value, ::std::size_t fallback) noexcept {
+				char* end{};
+				unsigned long long res{::std::strtoull(value, &end, 10)};
+				return end != value && *end == '\0' && res != 0 ? (::std::size_t)res : fallback;
+			}
+
+			inline ::std::size_t resolve() noexcept {
+				::std::size_t detected{::std::thread::hardware_concurrency()}, res{detected == 0 ? 1 : detected};
+#ifdef _MSC_VER
+				char* value{};
+				if (_dupenv_s(&value, nullptr, "CONCRETE_THREADS") == 0 && value != nullptr) {
+					res = parse(value, res);
+					::std::free(value);
+				}
+#else
+				if (const char* value{::std::getenv("CONCRETE_THREADS")}; value != nullptr) {
+					res = parse(value, res);
+				}
+#endif
+				return res;
+			}
+
+			inline ::std::size_t hardware_threads() noexcept {
+				static const ::std::size_t res{::concrete::detail::parallel::resolve()};
+				return res;
+			}
+
+			inline ::std::size_t thread_count(::std::size_t size) noexcept {
+				::std::size_t hardware{::concrete::detail::parallel::hardware_threads()};
+				::std::size_t blocks{size / grain};
+				return blocks < hardware ? blocks : hardware;
+			}
+
+			class worker_pool {
+				::std::mutex _mutex;
+				::std::condition_variable _start, _finish;
+				::std::vector<::std::thread> _workers;
+				::std::atomic<bool> _busy{false};
+				void (*_invoke)(void*, ::std::size_t){nullptr};
+				void* _context{nullptr};
+				::std::size_t _next{0}, _count{0}, _remaining{0};
+				bool _stop{false};
+
+				void _work() {
+					::std::unique_lock<::std::mutex> lock{_mutex};
+					while (true) {
+						_start.wait(lock, [this] { return _stop || _next != _count; });
+						if (_stop) {
+							return;
+						}
+						::std::size_t index{_next++};
+						lock.unlock();
+						_invoke(_context, index);
+						lock.lock();
+						if (--_remaining == 0) {
+							_finish.notify_one();
+						}
+					}
+				}
+
+			public:
+				worker_pool() = default;
+
+				worker_pool(const worker_pool&) = delete;
+
+				worker_pool& operator=(const worker_pool&) = delete;
+
+				~worker_pool() {
+					{
+						::std::lock_guard<::std::mutex> lock{_mutex};
+						_stop = true;
+					}
+					_start.notify_all();
+					for (::std::thread& worker : _workers) {
+						worker.join();
+					}
+				}
+
+				template<class Fn>
+				void run(::std::size_t count, Fn& function) {
+					if (count <= 1 || _busy.exchange(true, ::std::memory_order_acquire)) {
+						for (::std::size_t t{0}; t < count; ++t) {
+							function(t);
+						}
+						return;
+					}
+					{
+						::std::lock_guard<::std::mutex> lock{_mutex};
+						while (_workers.size() + 1 < count) {
+							_workers.emplace_back(&worker_pool::_work, this);
+						}
+						_invoke = [](void* context, ::std::size_t index) { (*(Fn*)context)(index); };
+						_context = &function;
+						_next = 1;
+						_count = count;
+						_remaining = count - 1;
+					}
+					_start.notify_all();
+					function(0);
+					{
+						::std::unique_lock<::std::mutex> lock{_mutex};
+						_finish.wait(lock, [this] { return _remaining == 0; });
+					}
+					_busy.store(false, ::std::memory_order_release);
+				}
+			};
+
+			inline ::concrete::detail::parallel::worker_pool& pool() {
+				static ::concrete::detail::parallel::worker_pool res;
+				return res;
+			}
+
+			template<class Fn>
+			void for_each_block(::std::size_t size, ::std::size_t count, Fn function) {
+				auto block{[&](::std::size_t t) { function(t, size * t / count, size * (t + 1) / count); }};
+				::concrete::detail::parallel::pool().run(count, block);
+			}
+
+		}
+
+		template<class input_iterator, class T, class Op>
+		T reduce(input_iterator first, input_iterator last, T init, Op op) {
+			if constexpr (::concrete::algebraic_traits<Op>::associative && ::concrete::algebraic_traits<Op>::commutative && ::concrete::detail::parallel::is_random_access_v<input_iterator>) {
+				::std::size_t size{(::std::size_t)(last - first)}, i{0};
+				if (size >= 8) {
+					T acc[4]{first[0], first[1], first[2], first[3]};
+					for (i = 4; i + 4 <= size; i += 4) {
+						acc[0] = op(acc[0], first[i]);
+						acc[1] = op(acc[1], first[i + 1]);
+						acc[2] = op(acc[2], first[i + 2]);
+						acc[3] = op(acc[3], first[i + 3]);
+					}
+					init = op(init, op(op(acc[0], acc[1]), op(acc[2], acc[3])));
+				}
+				for (; i != size; ++i) {
+					init = op(init, first[i]);
+				}
+				return init;
+			}
+			else {
+				for (; first != last; ++first) {
+					init = op(init, *first);
+				}
+				return init;
+			}
+		}
+
+		template<class input_iterator, class output_iterator, class T, class Op>
+		output_iterator inclusive_scan(input_iterator first, input_iterator last, output_iterator d_first, T init, Op op) {
+			for (; first != last; ++first, ++d_first) {
+				init = op(init, *first);
+				*d_first = init;
+			}
+			return d_first;
+		}
+
+		template<class input_iterator, class output_iterator, class T, class Op>
+		output_iterator exclusive_scan(input_iterator first, input_iterator last, output_iterator d_first, T init, Op op) {
+			for (; first != last; ++first, ++d_first) {
+				T t{op(init, *first)};
+				*d_first = init;
+				init = ::std::move(t);
+			}
+			return d_first;
+		}
+
+		template<class input_iterator, class output_iterator, class T, class Op, bool is_inclusive>
+		output_iterator scan(input_iterator first, input_iterator last, output_iterator d_first, T init, Op op) {
+			using namespace ::concrete::detail::parallel;
+			constexpr bool parallel{::concrete::is_semigroup_v<Op> && is_random_access_v<input_iterator> && is_random_access_v<output_iterator>};
+			::std::size_t count{};
+			if constexpr (parallel) {
+				count = thread_count((::std::size_t)(last - first));
+			}
+			if (count <= 1) {
+				if constexpr (is_inclusive) {
+					return ::concrete::detail::inclusive_scan(first, last, d_first, init, op);
+				}
+				else {
+					return ::concrete::detail::exclusive_scan(first, last, d_first, init, op);
+				}
+			}
+			if constexpr (parallel) {
+				::std::size_t size{(::std::size_t)(last - first)};
+				::std::vector<T> partial(count);
+				for_each_block(size, count, [&](::std::size_t t, ::std::size_t begin, ::std::size_t end) {
+					if (t + 1 != count) {
+						partial[t + 1] = ::concrete::detail::reduce(first + begin + 1, first + end, T(first[begin]), op);
+					}
+				});
+				partial[0] = init;
+				for (::std::size_t t{1}; t != count; ++t) {
+					partial[t] = op(partial[t - 1], partial[t]);
+				}
+				for_each_block(size, count, [&](::std::size_t t, ::std::size_t begin, ::std::size_t end) {
+					if constexpr (is_inclusive) {
+						::concrete::detail::inclusive_scan(first + begin, first + end, d_first + begin, partial[t], op);
+					}
+					else {
+						::concrete::detail::exclusive_scan(first + begin, first + end, d_first + begin, partial[t], op);
+					}
+				});
+				return d_first + size;
+			}
+			return d_first;
+		}
+
+	}
+
+	template<class input_iterator, class T, class Op = ::concrete::add<T>>
+	T reduce(input_iterator first, input_iterator last, T init, Op op = {}) {
+		using namespace ::concrete::detail::parallel;
+		if constexpr (::concrete::is_semigroup_v<Op> && is_random_access_v<input_iterator>) {
+			::std::size_t size{(::std::size_t)(last - first)};
+			::std::size_t count{thread_count(size)};
+			if (count > 1) {
+				::std::vector<T> partial(count);
+				for_each_block(size, count, [&](::std::size_t t, ::std::size_t begin, ::std::size_t end) {
+					partial[t] = ::concrete::detail::reduce(first + begin + 1, first + end, T(first[begin]), op);
+				});
+				return ::concrete::detail::reduce(partial.begin(), partial.end(), init, op);
+			}
+		}
+		return ::concrete::detail::reduce(first, last, init, op);
+	}
+
+	template<class input_iterator, class output_iterator, class Op, class T>
+	output_iterator inclusive_scan(input_iterator first, input_iterator last, output_iterator d_first, Op op, T init) {
+		return ::concrete::detail::scan<input_iterator, output_iterator, T, Op, true>(first, last, d_first, init, op);
+	}
+
+	template<class input_iterator, class output_iterator, class Op>
+	output_iterator inclusive_scan(input_iterator first, input_iterator last, output_iterator d_first, Op op) {
+		if (first == last) {
+			return d_first;
+		}
+		typename ::std::iterator_traits<input_iterator>::value_type init{*first};
+		*d_first = init;
+		return ::concrete::inclusive_scan(++first, last, ++d_first, op, init);
+	}
+
+	template<class input_iterator, class output_iterator>
+	output_iterator inclusive_scan(input_iterator first, input_iterator last, output_iterator d_first) {
+		return ::concrete::inclusive_scan(first, last, d_first, ::concrete::add<typename ::std::iterator_traits<input_iterator>::value_type>{});
+	}
+
+	template<class input_iterator, class output_iterator, class T, class Op = ::concrete::add<T>>
+	output_iterator exclusive_scan(input_iterator first, input_iterator last, output_iterator d_first, T init, Op op = {}) {
+		return ::concrete::detail::scan<input_iterator, output_iterator, T, Op, false>(first, last, d_first, init, op);
+	}
+
+}
\ No newline at end of file
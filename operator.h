@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <limits>
 
 namespace concrete {
 
@@ -167,6 +168,7 @@ namespace concrete {
 		static constexpr bool associative{false};
 		static constexpr bool invertible{false};
 		static constexpr bool commutative{false};
+		static constexpr bool idempotent{false};
 		using algebraic_structure_tag = ::concrete::set_tag;
 	};
 
@@ -176,6 +178,7 @@ namespace concrete {
 		static constexpr T identity{0};
 		static constexpr bool invertible{true};
 		static constexpr bool commutative{true};
+		static constexpr bool idempotent{false};
 		using algebraic_structure_tag = ::concrete::group_tag;
 	};
 
@@ -184,6 +187,7 @@ namespace concrete {
 		static constexpr bool associative{false};
 		static constexpr bool invertible{false};
 		static constexpr bool commutative{false};
+		static constexpr bool idempotent{false};
 		using algebraic_structure_tag = ::concrete::magma_tag;
 	};
 
@@ -193,6 +197,7 @@ namespace concrete {
 		static constexpr T identity{1};
 		static constexpr bool invertible{true};
 		static constexpr bool commutative{true};
+		static constexpr bool idempotent{false};
 		using algebraic_structure_tag = ::concrete::group_tag;
 	};
 
@@ -201,6 +206,7 @@ namespace concrete {
 		static constexpr bool associative{false};
 		static constexpr bool invertible{false};
 		static constexpr bool commutative{false};
+		static constexpr bool idempotent{false};
 		using algebraic_structure_tag = ::concrete::magma_tag;
 	};
 
@@ -209,6 +215,7 @@ namespace concrete {
 		static constexpr bool associative{false};
 		static constexpr bool invertible{false};
 		static constexpr bool commutative{false};
+		static constexpr bool idempotent{false};
 		using algebraic_structure_tag = ::concrete::magma_tag;
 	};
 
@@ -247,31 +254,80 @@ namespace concrete {
 	template<class T, class Compare = ::std::less<T>>
 	struct maximum {
 		constexpr T operator()(const T& x, const T& y) const noexcept {
-			return ::std::max<T, Compare>(x, y);
+			return ::std::max(x, y, Compare{});
 		}
 	};
 
 	template<class T, class Compare = ::std::less<T>>
 	struct minimum {
 		constexpr T operator()(const T& x, const T& y) const noexcept {
-			return ::std::min<T, Compare>(x, y);
+			return ::std::min(x, y, Compare{});
 		}
 	};
 
+	namespace detail {
+
+		template<class T, class Compare, bool is_maximum, class = void>
+		struct extremum_traits {
+			static constexpr bool associative{true};
+			static constexpr bool invertible{false};
+			static constexpr bool commutative{true};
+			static constexpr bool idempotent{true};
+			using algebraic_structure_tag = ::concrete::semigroup_tag;
+		};
+
+		template<class T, bool is_maximum>
+		struct extremum_traits<T, ::std::less<T>, is_maximum, ::std::enable_if_t<::std::numeric_limits<T>::is_bounded>> {
+			static constexpr bool associative{true};
+			static constexpr T identity{is_maximum ? ::std::numeric_limits<T>::lowest() : ::std::numeric_limits<T>::max()};
+			static constexpr bool invertible{false};
+			static constexpr bool commutative{true};
+			static constexpr bool idempotent{true};
+			using algebraic_structure_tag = ::concrete::monoid_tag;
+		};
+
+	}
+
 	template<class T, class Compare>
-	struct algebraic_traits<::concrete::maximum<T, Compare>> {
-		static constexpr bool associative{true};
-		static constexpr bool invertible{false};
-		static constexpr bool commutative{true};
-		using algebraic_structure_tag = ::concrete::semigroup_tag;
-	};
+	struct algebraic_traits<::concrete::maximum<T, Compare>> : ::concrete::detail::extremum_traits<T, Compare, true> {};
 
 	template<class T, class Compare>
-	struct algebraic_traits<::concrete::minimum<T, Compare>> {
-		static constexpr bool associative{true};
-		static constexpr bool invertible{false};
-		static constexpr bool commutative{true};
-		using algebraic_structure_tag = ::concrete::semigroup_tag;
+	struct algebraic_traits<::concrete::minimum<T, Compare>> : ::concrete::detail::extremum_traits<T, Compare, false> {};
+
+	template<class Add, class Mul>
+	struct semiring_traits {
+		using add_operator = Add;
+		using multiply_operator = Mul;
+		static constexpr auto zero{::concrete::algebraic_traits<Add>::identity};
+		static constexpr auto one{::concrete::algebraic_traits<Mul>::identity};
+	};
+
+	namespace detail {
+
+		template<class T, bool is_minimum>
+		struct tropical_traits {
+			using add_operator = ::std::conditional_t<is_minimum, ::concrete::minimum<T>, ::concrete::maximum<T>>;
+			using multiply_operator = ::concrete::add<T>;
+			static constexpr T zero{
+				!::std::is_integral_v<T> && ::std::numeric_limits<T>::has_infinity ? (is_minimum ? 1 : -1) * ::std::numeric_limits<T>::infinity() :
+				is_minimum ? ::std::numeric_limits<T>::max() / 2 : ::std::numeric_limits<T>::lowest() / 2};
+			static constexpr T one{0};
+		};
+
+	}
+
+	template<class T>
+	struct semiring_traits<::concrete::minimum<T>, ::concrete::add<T>> : ::concrete::detail::tropical_traits<T, true> {};
+
+	template<class T>
+	struct semiring_traits<::concrete::maximum<T>, ::concrete::add<T>> : ::concrete::detail::tropical_traits<T, false> {};
+
+	template<class Add, class Mul>
+	constexpr bool is_semiring_v{::concrete::is_monoid_v<Add> && ::concrete::algebraic_traits<Add>::commutative && ::concrete::is_monoid_v<Mul>};
+
+	template<class Add, class Mul>
+	struct is_semiring {
+		static constexpr bool value{::concrete::is_semiring_v<Add, Mul>};
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,280 @@
+#pragma once
+
+#include "integral.h"
+
+#include <chrono>
+
+#ifdef CONCRETE_PERF_COUNTERS
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
+namespace concrete {
+
+	enum class perf_event : int {
+		cycles,
+		instructions,
+		l1d_misses,
+		llc_misses,
+		branch_misses,
+		tsc
+	};
+
+	constexpr ::std::size_t perf_event_count{6};
+
+	constexpr const char* perf_event_name(::concrete::perf_event event) noexcept {
+		constexpr const char* names[]{"cycles", "instructions", "L1D-misses", "LLC-misses", "branch-misses", "tsc"};
+		return names[(int)event];
+	}
+
+	struct perf_sample {
+		::concrete::uint64_t values[::concrete::perf_event_count]{};
+		unsigned mask{0};
+		bool hardware{false};
+
+		constexpr bool has(::concrete::perf_event event) const noexcept {
+			return mask >> (int)event & 1;
+		}
+
+		constexpr ::concrete::uint64_t operator[](::concrete::perf_event event) const noexcept {
+			return values[(int)event];
+		}
+
+		constexpr perf_sample& operator+=(const perf_sample& x) noexcept {
+			for (::std::size_t i{0}; i != ::concrete::perf_event_count; ++i) {
+				values[i] += x.values[i];
+			}
+			mask |= x.mask;
+			hardware |= x.hardware;
+			return *this;
+		}
+	};
+
+	namespace detail {
+
+		namespace perf {
+
+			inline ::concrete::uint64_t timestamp() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+				return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+				return __builtin_ia32_rdtsc();
+#else
+				return (::concrete::uint64_t)::std::chrono::duration_cast<::std::chrono::nanoseconds>(::std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+			}
+
+		}
+
+	}
+
+#if defined(CONCRETE_PERF_COUNTERS) && defined(__linux__)
+	class perf_counters {
+		struct _reading {
+			::concrete::uint64_t count, enabled, running;
+			::concrete::uint64_t values[::concrete::perf_event_count];
+		};
+
+		int _leader;
+		int _fds[::concrete::perf_event_count];
+		int _slots[::concrete::perf_event_count];
+		::concrete::uint64_t _count;
+		_reading _begin;
+		::concrete::uint64_t _beginTimestamp;
+		::concrete::perf_sample _total;
+
+		static int _open(::concrete::perf_event event, int group) noexcept {
+			constexpr ::concrete::uint64_t cache{PERF_COUNT_HW_CACHE_L1D | PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16};
+			perf_event_attr attr{};
+			attr.size = sizeof(attr);
+			attr.type = event == ::concrete::perf_event::l1d_misses ? PERF_TYPE_HW_CACHE : PERF_TYPE_HARDWARE;
+			switch (event) {
+			case ::concrete::perf_event::cycles:
+				attr.config = PERF_COUNT_HW_CPU_CYCLES;
+				break;
+			case ::concrete::perf_event::instructions:
+				attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+				break;
+			case ::concrete::perf_event::l1d_misses:
+				attr.config = cache;
+				break;
+			case ::concrete::perf_event::llc_misses:
+				attr.config = PERF_COUNT_HW_CACHE_MISSES;
+				break;
+			case ::concrete::perf_event::branch_misses:
+				attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+				break;
+			case ::concrete::perf_event::tsc:
+				return -1;
+			}
+			attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			return (int)::syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+		}
+
+		_reading _read() const noexcept {
+			_reading res{};
+			if (::read(_leader, &res, sizeof(::concrete::uint64_t) * (3 + _count)) <= 0) {
+				res.count = 0;
+			}
+			return res;
+		}
+
+	public:
+		perf_counters() noexcept : _leader{-1}, _count{0}, _begin{}, _beginTimestamp{0} {
+			for (::std::size_t i{0}; i != ::concrete::perf_event_count; ++i) {
+				_fds[i] = _open((::concrete::perf_event)i, _leader);
+				_slots[i] = -1;
+				if (_fds[i] != -1) {
+					_leader = _leader == -1 ? _fds[i] : _leader;
+					_slots[i] = (int)_count++;
+					_total.mask |= 1u << i;
+				}
+			}
+			_total.hardware = _leader != -1;
+			if (_leader == -1) {
+				_total.mask |= 1u << (int)::concrete::perf_event::tsc;
+			}
+		}
+
+		perf_counters(const perf_counters&) = delete;
+
+		perf_counters& operator=(const perf_counters&) = delete;
+
+		~perf_counters() {
+			for (int fd : _fds) {
+				if (fd != -1) {
+					::close(fd);
+				}
+			}
+		}
+
+		bool hardware() const noexcept {
+			return _leader != -1;
+		}
+
+		void start() noexcept {
+			if (_leader != -1) {
+				_begin = _read();
+			}
+			else {
+				_beginTimestamp = ::concrete::detail::perf::timestamp();
+			}
+		}
+
+		void stop() noexcept {
+			if (_leader == -1) {
+				_total.values[(int)::concrete::perf_event::tsc] += ::concrete::detail::perf::timestamp() - _beginTimestamp;
+				return;
+			}
+			_reading end{_read()};
+			if (end.count != _count || _begin.count != _count) {
+				return;
+			}
+			::concrete::uint64_t enabled{end.enabled - _begin.enabled}, running{end.running - _begin.running};
+			for (::std::size_t i{0}; i != ::concrete::perf_event_count; ++i) {
+				if (_slots[i] != -1) {
+					::concrete::uint64_t delta{end.values[_slots[i]] - _begin.values[_slots[i]]};
+					if (running != 0 && running < enabled) {
+						delta = (::concrete::uint64_t)((double)delta * enabled / running);
+					}
+					_total.values[i] += delta;
+				}
+			}
+		}
+
+		void reset() noexcept {
+			for (::concrete::uint64_t& x : _total.values) {
+				x = 0;
+			}
+		}
+
+		const ::concrete::perf_sample& sample() const noexcept {
+			return _total;
+		}
+	};
+#elif defined(CONCRETE_PERF_COUNTERS)
+	class perf_counters {
+		::concrete::uint64_t _begin;
+		::concrete::perf_sample _total;
+
+	public:
+		perf_counters() noexcept : _begin{0} {
+			_total.mask = 1u << (int)::concrete::perf_event::tsc;
+		}
+
+		bool hardware() const noexcept {
+			return false;
+		}
+
+		void start() noexcept {
+			_begin = ::concrete::detail::perf::timestamp();
+		}
+
+		void stop() noexcept {
+			_total.values[(int)::concrete::perf_event::tsc] += ::concrete::detail::perf::timestamp() - _begin;
+		}
+
+		void reset() noexcept {
+			_total.values[(int)::concrete::perf_event::tsc] = 0;
+		}
+
+		const ::concrete::perf_sample& sample() const noexcept {
+			return _total;
+		}
+	};
+#else
+	class perf_counters {
+		static constexpr ::concrete::perf_sample _total{};
+
+	public:
+		constexpr bool hardware() const noexcept {
+			return false;
+		}
+
+		constexpr void start() const noexcept {}
+
+		constexpr void stop() const noexcept {}
+
+		constexpr void reset() const noexcept {}
+
+		constexpr const ::concrete::perf_sample& sample() const noexcept {
+			return _total;
+		}
+	};
+#endif
+
+	class perf_scope {
+		::concrete::perf_counters& _counters;
+
+	public:
+		explicit perf_scope(::concrete::perf_counters& counters) noexcept : _counters{counters} {
+			_counters.start();
+		}
+
+		perf_scope(const perf_scope&) = delete;
+
+		perf_scope& operator=(const perf_scope&) = delete;
+
+		~perf_scope() {
+			_counters.stop();
+		}
+	};
+
+#ifdef BENCHMARK_BENCHMARK_H_
+	inline void set_perf_counters(::benchmark::State& state, const ::concrete::perf_counters& counters, double ops) {
+		const ::concrete::perf_sample& sample{counters.sample()};
+		for (::std::size_t i{0}; i != ::concrete::perf_event_count; ++i) {
+			auto event{(::concrete::perf_event)i};
+			if (sample.has(event)) {
+				state.counters[::concrete::perf_event_name(event)] = ::benchmark::Counter((double)sample[event] / ops);
+			}
+		}
+	}
+#endif
+
+}
\ No newline at end of file
@@ -0,0 +1,360 @@
+#pragma once
+
+#include "integral.h"
+#include "standard.h"
+
+#include <limits>
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace random {
+
+			constexpr ::concrete::uint64_t splitmix64(::concrete::uint64_t& x) noexcept {
+				::concrete::uint64_t z{x += 0x9E3779B97F4A7C15};
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+				return z ^ (z >> 31);
+			}
+
+			constexpr ::concrete::uint32_t philox_m0{0xD2511F53}, philox_m1{0xCD9E8D57};
+
+			constexpr ::concrete::uint32_t philox_w0{0x9E3779B9}, philox_w1{0xBB67AE85};
+
+			constexpr void philox_block(::concrete::uint64_t key, ::concrete::uint64_t low, ::concrete::uint64_t high, ::concrete::uint32_t* out) noexcept {
+				::concrete::uint32_t c0{(::concrete::uint32_t)low}, c1{(::concrete::uint32_t)(low >> 32)}, c2{(::concrete::uint32_t)high}, c3{(::concrete::uint32_t)(high >> 32)};
+				::concrete::uint32_t k0{(::concrete::uint32_t)key}, k1{(::concrete::uint32_t)(key >> 32)};
+				for (int i{0}; i != 10; ++i) {
+					::concrete::uint64_t p0{(::concrete::uint64_t)::concrete::detail::random::philox_m0 * c0};
+					::concrete::uint64_t p1{(::concrete::uint64_t)::concrete::detail::random::philox_m1 * c2};
+					c0 = (::concrete::uint32_t)(p1 >> 32) ^ c1 ^ k0;
+					c1 = (::concrete::uint32_t)p1;
+					c2 = (::concrete::uint32_t)(p0 >> 32) ^ c3 ^ k1;
+					c3 = (::concrete::uint32_t)p0;
+					k0 += ::concrete::detail::random::philox_w0;
+					k1 += ::concrete::detail::random::philox_w1;
+				}
+				out[0] = c0;
+				out[1] = c1;
+				out[2] = c2;
+				out[3] = c3;
+			}
+
+			inline void philox_fill(::concrete::uint64_t key, ::concrete::uint64_t low, ::concrete::uint64_t high, ::concrete::uint32_t* out, ::std::size_t blocks) noexcept {
+				for (::std::size_t i{0}; i != blocks; ++i) {
+					::concrete::uint64_t counter{low + i};
+					::concrete::detail::random::philox_block(key, counter, high + (counter < low), out + i * 4);
+				}
+			}
+
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+			[[gnu::target("avx2,bmi,bmi2,lzcnt,fma"), gnu::flatten]] inline void philox_fill_avx2(::concrete::uint64_t key, ::concrete::uint64_t low, ::concrete::uint64_t high,
+				::concrete::uint32_t* out, ::std::size_t blocks) noexcept {
+				::concrete::detail::random::philox_fill(key, low, high, out, blocks);
+			}
+
+			[[gnu::target("avx512f,avx512dq,avx512bw,avx512vl,avx2,bmi,bmi2,lzcnt,fma"), gnu::flatten]] inline void philox_fill_avx512(::concrete::uint64_t key, ::concrete::uint64_t low, ::concrete::uint64_t high,
+				::concrete::uint32_t* out, ::std::size_t blocks) noexcept {
+				::concrete::detail::random::philox_fill(key, low, high, out, blocks);
+			}
+#endif
+
+			inline const auto& philox_fill_dispatch() {
+				static const ::concrete::dispatch<void(::concrete::uint64_t, ::concrete::uint64_t, ::concrete::uint64_t, ::concrete::uint32_t*, ::std::size_t)> res{
+					{::concrete::isa::generic, &::concrete::detail::random::philox_fill},
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+					{::concrete::isa::avx2, &::concrete::detail::random::philox_fill_avx2},
+					{::concrete::isa::avx512, &::concrete::detail::random::philox_fill_avx512},
+#endif
+				};
+				return res;
+			}
+
+			template<class Engine>
+			constexpr ::concrete::uint64_t next64(Engine& engine) {
+				using result_type = typename Engine::result_type;
+				if constexpr (sizeof(result_type) >= sizeof(::concrete::uint64_t)) {
+					return (::concrete::uint64_t)engine();
+				}
+				else {
+					::concrete::uint64_t high{(::concrete::uint64_t)engine()};
+					return high << 32 | (::concrete::uint64_t)engine();
+				}
+			}
+
+		}
+
+	}
+
+	class xoshiro256pp {
+		::concrete::uint64_t _s[4];
+
+		constexpr void _jump(const ::concrete::uint64_t (&polynomial)[4]) noexcept {
+			::concrete::uint64_t t[4]{};
+			for (::concrete::uint64_t word : polynomial) {
+				for (int b{0}; b != 64; ++b) {
+					if (word >> b & 1) {
+						for (int i{0}; i != 4; ++i) {
+							t[i] ^= _s[i];
+						}
+					}
+					operator()();
+				}
+			}
+			for (int i{0}; i != 4; ++i) {
+				_s[i] = t[i];
+			}
+		}
+
+	public:
+		using result_type = ::concrete::uint64_t;
+
+		static constexpr result_type min() noexcept {
+			return 0;
+		}
+
+		static constexpr result_type max() noexcept {
+			return ::std::numeric_limits<result_type>::max();
+		}
+
+		explicit constexpr xoshiro256pp(::concrete::uint64_t seed = 0) noexcept : _s{} {
+			this->seed(seed);
+		}
+
+		constexpr void seed(::concrete::uint64_t seed) noexcept {
+			for (::concrete::uint64_t& x : _s) {
+				x = ::concrete::detail::random::splitmix64(seed);
+			}
+		}
+
+		constexpr result_type operator()() noexcept {
+			result_type res{::concrete::rotl(_s[0] + _s[3], 23) + _s[0]};
+			result_type t{_s[1] << 17};
+			_s[2] ^= _s[0];
+			_s[3] ^= _s[1];
+			_s[1] ^= _s[2];
+			_s[0] ^= _s[3];
+			_s[2] ^= t;
+			_s[3] = ::concrete::rotl(_s[3], 45);
+			return res;
+		}
+
+		constexpr void discard(unsigned long long n) noexcept {
+			while (n-- != 0) {
+				operator()();
+			}
+		}
+
+		constexpr void jump() noexcept {
+			_jump({0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C});
+		}
+
+		constexpr void long_jump() noexcept {
+			_jump({0x76E15D3EFEFDCBBF, 0xC5004E441C522FB3, 0x77710069854EE241, 0x39109BB02ACBE635});
+		}
+
+		constexpr xoshiro256pp split() noexcept {
+			xoshiro256pp res{*this};
+			jump();
+			return res;
+		}
+
+		constexpr void fill(result_type* first, ::std::size_t size) noexcept {
+			for (::std::size_t i{0}; i != size; ++i) {
+				first[i] = operator()();
+			}
+		}
+
+		friend constexpr bool operator==(const xoshiro256pp& x, const xoshiro256pp& y) noexcept {
+			return x._s[0] == y._s[0] && x._s[1] == y._s[1] && x._s[2] == y._s[2] && x._s[3] == y._s[3];
+		}
+
+		friend constexpr bool operator!=(const xoshiro256pp& x, const xoshiro256pp& y) noexcept {
+			return !(x == y);
+		}
+	};
+
+	class wyrand {
+		::concrete::uint64_t _state;
+
+		static constexpr ::concrete::uint64_t _increment{0xA0761D6478BD642F};
+
+	public:
+		using result_type = ::concrete::uint64_t;
+
+		static constexpr result_type min() noexcept {
+			return 0;
+		}
+
+		static constexpr result_type max() noexcept {
+			return ::std::numeric_limits<result_type>::max();
+		}
+
+		explicit constexpr wyrand(::concrete::uint64_t seed = 0) noexcept : _state{seed} {}
+
+		constexpr void seed(::concrete::uint64_t seed) noexcept {
+			_state = seed;
+		}
+
+		constexpr result_type operator()() noexcept {
+			_state += _increment;
+			::concrete::uint128_t t{(::concrete::uint128_t)_state * (_state ^ 0xE7037ED1A0B428DB)};
+			return (result_type)(t >> 64) ^ (result_type)t;
+		}
+
+		constexpr void discard(unsigned long long n) noexcept {
+			_state += n * _increment;
+		}
+
+		constexpr wyrand split(::concrete::uint64_t stride = ::concrete::uint64_t{1} << 48) noexcept {
+			wyrand res{*this};
+			discard(stride);
+			return res;
+		}
+
+		constexpr void fill(result_type* first, ::std::size_t size) noexcept {
+			for (::std::size_t i{0}; i != size; ++i) {
+				first[i] = operator()();
+			}
+		}
+
+		friend constexpr bool operator==(const wyrand& x, const wyrand& y) noexcept {
+			return x._state == y._state;
+		}
+
+		friend constexpr bool operator!=(const wyrand& x, const wyrand& y) noexcept {
+			return !(x == y);
+		}
+	};
+
+	class philox4x32 {
+		::concrete::uint64_t _key, _low, _high;
+		::concrete::uint32_t _buffer[4];
+		unsigned _index;
+
+		constexpr void _advance(::concrete::uint64_t blocks) noexcept {
+			::concrete::uint64_t low{_low + blocks};
+			_high += low < _low;
+			_low = low;
+		}
+
+		constexpr void _generate() noexcept {
+			::concrete::detail::random::philox_block(_key, _low, _high, _buffer);
+			_advance(1);
+			_index = 0;
+		}
+
+	public:
+		using result_type = ::concrete::uint32_t;
+
+		static constexpr result_type min() noexcept {
+			return 0;
+		}
+
+		static constexpr result_type max() noexcept {
+			return ::std::numeric_limits<result_type>::max();
+		}
+
+		explicit constexpr philox4x32(::concrete::uint64_t seed = 0, ::concrete::uint64_t stream = 0) noexcept : _key{seed}, _low{0}, _high{stream}, _buffer{}, _index{4} {}
+
+		constexpr void seed(::concrete::uint64_t seed, ::concrete::uint64_t stream = 0) noexcept {
+			*this = philox4x32{seed, stream};
+		}
+
+		constexpr result_type operator()() noexcept {
+			if (_index == 4) {
+				_generate();
+			}
+			return _buffer[_index++];
+		}
+
+		constexpr void discard(unsigned long long n) noexcept {
+			::concrete::uint64_t buffered{4 - (::concrete::uint64_t)_index};
+			if (n <= buffered) {
+				_index += (unsigned)n;
+				return;
+			}
+			n -= buffered;
+			_advance((n - 1) / 4);
+			_generate();
+			_index = (unsigned)((n - 1) % 4 + 1);
+		}
+
+		constexpr philox4x32 split() noexcept {
+			philox4x32 res{*this};
+			++_high;
+			return res;
+		}
+
+		void fill(result_type* first, ::std::size_t size) noexcept {
+			while (size != 0 && _index != 4) {
+				*first++ = _buffer[_index++];
+				--size;
+			}
+			::std::size_t blocks{size / 4};
+			::concrete::detail::random::philox_fill_dispatch()(_key, _low, _high, first, blocks);
+			_advance(blocks);
+			first += blocks * 4;
+			size -= blocks * 4;
+			while (size-- != 0) {
+				*first++ = operator()();
+			}
+		}
+
+		friend constexpr bool operator==(const philox4x32& x, const philox4x32& y) noexcept {
+			if (x._key != y._key || x._low != y._low || x._high != y._high || x._index != y._index) {
+				return false;
+			}
+			for (unsigned i{x._index}; i != 4; ++i) {
+				if (x._buffer[i] != y._buffer[i]) {
+					return false;
+				}
+			}
+			return true;
+		}
+
+		friend constexpr bool operator!=(const philox4x32& x, const philox4x32& y) noexcept {
+			return !(x == y);
+		}
+	};
+
+	template<class Engine, class T>
+	constexpr T uniform_int(Engine& engine, T bound) {
+		static_assert(::concrete::is_unsigned_v<T> && sizeof(T) <= sizeof(::concrete::uint64_t), "T should be an unsigned integral type of at most 64 bits.");
+		using result_type = typename Engine::result_type;
+		static_assert(Engine::min() == 0 && Engine::max() == ::std::numeric_limits<result_type>::max() && sizeof(result_type) >= sizeof(::concrete::uint32_t),
+			"Engine should produce all values of an unsigned integral type of at least 32 bits.");
+		if (sizeof(result_type) == sizeof(::concrete::uint32_t) && bound <= ::std::numeric_limits<::concrete::uint32_t>::max()) {
+			::concrete::uint32_t s{(::concrete::uint32_t)bound};
+			::concrete::uint64_t m{(::concrete::uint64_t)(::concrete::uint32_t)engine() * s};
+			if ((::concrete::uint32_t)m < s) {
+				::concrete::uint32_t t{(::concrete::uint32_t)-s % s};
+				while ((::concrete::uint32_t)m < t) {
+					m = (::concrete::uint64_t)(::concrete::uint32_t)engine() * s;
+				}
+			}
+			return (T)(m >> 32);
+		}
+		::concrete::uint64_t s{bound};
+		::concrete::uint128_t m{(::concrete::uint128_t)::concrete::detail::random::next64(engine) * s};
+		if ((::concrete::uint64_t)m < s) {
+			::concrete::uint64_t t{(::concrete::uint64_t)-s % s};
+			while ((::concrete::uint64_t)m < t) {
+				m = (::concrete::uint128_t)::concrete::detail::random::next64(engine) * s;
+			}
+		}
+		return (T)(m >> 64);
+	}
+
+	template<class Engine, class T>
+	constexpr T uniform_int(Engine& engine, T low, T high) {
+		using unsigned_type = ::concrete::make_unsigned_t<T>;
+		unsigned_type range{(unsigned_type)((unsigned_type)high - (unsigned_type)low)};
+		if (range == ::std::numeric_limits<unsigned_type>::max()) {
+			return (T)(unsigned_type)::concrete::detail::random::next64(engine);
+		}
+		return (T)((unsigned_type)low + ::concrete::uniform_int(engine, (unsigned_type)(range + 1)));
+	}
+
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "int_m.h"
+#include "standard.h"
+
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace hash {
+
+			constexpr ::std::size_t lanes{8};
+
+			constexpr ::std::size_t block{1 << 11};
+
+			template<class T, class U>
+			constexpr T digit(U x) noexcept {
+				if constexpr (::std::is_integral_v<U>) {
+					return T{(typename T::value_type)(::std::make_unsigned_t<U>)x};
+				}
+				else {
+					return T{(typename T::value_type)x};
+				}
+			}
+
+			template<class T, class U>
+			void build(const U* s, ::std::size_t size, T base, T* prefix, T* power) noexcept {
+				::std::size_t width{::std::min(::concrete::detail::hash::block, size / ::concrete::detail::hash::lanes)};
+				prefix[0] = T{0};
+				power[0] = T{1};
+				for (::std::size_t i{0}; i != width; ++i) {
+					power[i + 1] = power[i] * base;
+				}
+				::std::size_t first{0};
+				for (::std::size_t segment; (segment = ::std::min(width, (size - first) / ::concrete::detail::hash::lanes)) != 0; first += segment * ::concrete::detail::hash::lanes) {
+					T acc[::concrete::detail::hash::lanes]{};
+					acc[0] = prefix[first];
+					for (::std::size_t t{0}; t != segment; ++t) {
+						for (::std::size_t j{0}; j != ::concrete::detail::hash::lanes; ++j) {
+							acc[j] = acc[j] * base + ::concrete::detail::hash::digit<T>(s[first + j * segment + t]);
+							prefix[first + j * segment + t + 1] = acc[j];
+						}
+					}
+					for (::std::size_t j{0}; j != ::concrete::detail::hash::lanes; ++j) {
+						::std::size_t offset{first + j * segment};
+						T x{prefix[offset]}, y{power[offset]};
+						T* p{prefix + offset + 1};
+						T* q{power + offset + 1};
+						if (j != 0) {
+							for (::std::size_t t{0}; t != segment; ++t) {
+								p[t] += x * power[t + 1];
+							}
+						}
+						if (offset >= width) {
+							for (::std::size_t t{0}; t != segment; ++t) {
+								q[t] = y * power[t + 1];
+							}
+						}
+					}
+				}
+				for (::std::size_t i{first}; i != size; ++i) {
+					prefix[i + 1] = prefix[i] * base + ::concrete::detail::hash::digit<T>(s[i]);
+					power[i + 1] = power[i] * base;
+				}
+			}
+
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+			template<class T, class U>
+			[[gnu::target("avx2,bmi,bmi2,lzcnt,fma"), gnu::flatten]] void build_avx2(const U* s, ::std::size_t size, T base, T* prefix, T* power) noexcept {
+				::concrete::detail::hash::build(s, size, base, prefix, power);
+			}
+
+			template<class T, class U>
+			[[gnu::target("avx512f,avx512dq,avx512bw,avx512vl,avx2,bmi,bmi2,lzcnt,fma"), gnu::flatten]] void build_avx512(const U* s, ::std::size_t size, T base, T* prefix, T* power) noexcept {
+				::concrete::detail::hash::build(s, size, base, prefix, power);
+			}
+#endif
+
+			template<class T, class U>
+			const auto& build_dispatch() {
+				static const ::concrete::dispatch<void(const U*, ::std::size_t, T, T*, T*)> res{
+					{::concrete::isa::generic, &::concrete::detail::hash::build<T, U>},
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+					{::concrete::isa::avx2, &::concrete::detail::hash::build_avx2<T, U>},
+					{::concrete::isa::avx512, &::concrete::detail::hash::build_avx512<T, U>},
+#endif
+				};
+				return res;
+			}
+
+		}
+
+	}
+
+	template<class T = ::concrete::int_m<2305843009213693951ull>>
+	class rolling_hash {
+		::std::vector<T> _prefix, _power;
+
+	public:
+		using value_type = T;
+
+		template<class U>
+		rolling_hash(const U* s, ::std::size_t size, T base) : _prefix(size + 1), _power(size + 1) {
+			::concrete::detail::hash::build_dispatch<T, U>()(s, size, base, _prefix.data(), _power.data());
+		}
+
+		rolling_hash(::std::string_view s, T base) : rolling_hash(s.data(), s.size(), base) {}
+
+		::std::size_t size() const noexcept {
+			return _prefix.size() - 1;
+		}
+
+		T hash() const noexcept {
+			return _prefix.back();
+		}
+
+		T operator()(::std::size_t first, ::std::size_t last) const noexcept {
+			return _prefix[last] - _prefix[first] * _power[last - first];
+		}
+
+		T power(::std::size_t n) const noexcept {
+			return _power[n];
+		}
+
+		T concat(T x, T y, ::std::size_t ySize) const noexcept {
+			return x * _power[ySize] + y;
+		}
+	};
+
+}
\ No newline at end of file
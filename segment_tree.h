@@ -0,0 +1,441 @@
+#pragma once
+
+#include "operator.h"
+#include "standard.h"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+namespace concrete {
+
+	namespace detail {
+
+		template<class T, class Op>
+		constexpr T repeat(T x, ::std::size_t count) noexcept {
+			if constexpr (::std::is_same_v<Op, ::concrete::add<T>>) {
+				return x * (T)count;
+			}
+			else if constexpr (::concrete::algebraic_traits<Op>::idempotent) {
+				return count != 0 ? x : ::concrete::algebraic_traits<Op>::identity;
+			}
+			else {
+				T res{::concrete::algebraic_traits<Op>::identity};
+				while (count != 0) {
+					if (count & 1) {
+						res = Op{}(res, x);
+					}
+					x = Op{}(x, x);
+					count >>= 1;
+				}
+				return res;
+			}
+		}
+
+	}
+
+	template<class T, class Op = ::concrete::add<T>>
+	struct range_add {
+		static_assert(::std::is_same_v<Op, ::concrete::add<T>> || ::std::is_same_v<Op, ::concrete::minimum<T>> || ::std::is_same_v<Op, ::concrete::maximum<T>>,
+			"Op should be add, minimum or maximum.");
+
+		using operator_type = T;
+
+		static constexpr operator_type identity{0};
+
+		static constexpr operator_type compose(const operator_type& f, const operator_type& g) noexcept {
+			return f + g;
+		}
+
+		static constexpr T apply(const operator_type& f, const T& x, ::std::size_t count) noexcept {
+			if constexpr (::std::is_same_v<Op, ::concrete::add<T>>) {
+				return x + f * (T)count;
+			}
+			else {
+				return x + f;
+			}
+		}
+	};
+
+	template<class T, class Op = ::concrete::add<T>>
+	struct range_assign {
+		using operator_type = ::std::optional<T>;
+
+		static constexpr operator_type identity{};
+
+		static constexpr operator_type compose(const operator_type& f, const operator_type& g) noexcept {
+			return f ? f : g;
+		}
+
+		static constexpr T apply(const operator_type& f, const T& x, ::std::size_t count) noexcept {
+			return f ? ::concrete::detail::repeat<T, Op>(*f, count) : x;
+		}
+	};
+
+	template<class T, class Op = ::concrete::add<T>>
+	class segment_tree {
+		static_assert(::concrete::is_monoid_v<Op>, "Op should be a monoid.");
+
+		using traits = ::concrete::algebraic_traits<Op>;
+
+		static constexpr Op _op{};
+
+		::std::size_t _size, _capacity;
+		::std::vector<T> _data;
+
+		void _update(::std::size_t index) {
+			_data[index] = _op(_data[index << 1], _data[index << 1 | 1]);
+		}
+
+		void _build() {
+			for (::std::size_t i{_capacity - 1}; i != 0; --i) {
+				_update(i);
+			}
+		}
+
+	public:
+		explicit segment_tree(::std::size_t size) :
+			_size{size},
+			_capacity{::concrete::bit_ceil(size)},
+			_data(_capacity << 1, traits::identity) {}
+
+		template<class input_iterator>
+		explicit segment_tree(input_iterator first, input_iterator last) : segment_tree(::std::vector<T>(first, last)) {}
+
+		explicit segment_tree(const ::std::vector<T>& values) : segment_tree(values.size()) {
+			::std::copy(values.begin(), values.end(), _data.begin() + _capacity);
+			_build();
+		}
+
+		::std::size_t size() const noexcept {
+			return _size;
+		}
+
+		T operator[](::std::size_t index) const noexcept {
+			return _data[index + _capacity];
+		}
+
+		void set(::std::size_t index, const T& value) {
+			index += _capacity;
+			_data[index] = value;
+			while (index >>= 1) {
+				_update(index);
+			}
+		}
+
+		void apply(::std::size_t index, const T& value) {
+			set(index, _op(_data[index + _capacity], value));
+		}
+
+		T query(::std::size_t first, ::std::size_t last) const noexcept {
+			first += _capacity;
+			last += _capacity;
+			if constexpr (traits::commutative) {
+				T res{traits::identity};
+				while (first < last) {
+					if (first & 1) {
+						res = _op(res, _data[first++]);
+					}
+					if (last & 1) {
+						res = _op(res, _data[--last]);
+					}
+					first >>= 1;
+					last >>= 1;
+				}
+				return res;
+			}
+			else {
+				T left{traits::identity}, right{traits::identity};
+				while (first < last) {
+					if (first & 1) {
+						left = _op(left, _data[first++]);
+					}
+					if (last & 1) {
+						right = _op(_data[--last], right);
+					}
+					first >>= 1;
+					last >>= 1;
+				}
+				return _op(left, right);
+			}
+		}
+
+		T query() const noexcept {
+			return _data[1];
+		}
+
+		template<class Pred>
+		::std::size_t max_right(::std::size_t first, Pred pred) const {
+			if (first == _size) {
+				return _size;
+			}
+			first += _capacity;
+			T sum{traits::identity};
+			do {
+				first >>= ::concrete::countr_zero(first);
+				if (!pred(_op(sum, _data[first]))) {
+					while (first < _capacity) {
+						first <<= 1;
+						if (T t{_op(sum, _data[first])}; pred(t)) {
+							sum = t;
+							++first;
+						}
+					}
+					return first - _capacity;
+				}
+				sum = _op(sum, _data[first++]);
+			} while (!::concrete::has_single_bit(first));
+			return _size;
+		}
+
+		template<class Pred>
+		::std::size_t min_left(::std::size_t last, Pred pred) const {
+			if (last == 0) {
+				return 0;
+			}
+			last += _capacity;
+			T sum{traits::identity};
+			do {
+				--last;
+				while (last > 1 && (last & 1)) {
+					last >>= 1;
+				}
+				if (!pred(_op(_data[last], sum))) {
+					while (last < _capacity) {
+						last = last << 1 | 1;
+						if (T t{_op(_data[last], sum)}; pred(t)) {
+							sum = t;
+							--last;
+						}
+					}
+					return last + 1 - _capacity;
+				}
+				sum = _op(_data[last], sum);
+			} while (!::concrete::has_single_bit(last));
+			return 0;
+		}
+	};
+
+	template<class T, class Op = ::concrete::add<T>, class Action = ::concrete::range_add<T, Op>>
+	class lazy_segment_tree {
+		static_assert(::concrete::is_monoid_v<Op>, "Op should be a monoid.");
+
+		using traits = ::concrete::algebraic_traits<Op>;
+		using F = typename Action::operator_type;
+
+		static constexpr Op _op{};
+
+		::std::size_t _size, _capacity;
+		int _log;
+		::std::vector<T> _data;
+		::std::vector<F> _lazy;
+
+		::std::size_t _length(::std::size_t index) const noexcept {
+			return _capacity >> (::concrete::bit_width(index) - 1);
+		}
+
+		void _update(::std::size_t index) {
+			_data[index] = _op(_data[index << 1], _data[index << 1 | 1]);
+		}
+
+		void _apply_all(::std::size_t index, const F& f) {
+			_data[index] = Action::apply(f, _data[index], _length(index));
+			if (index < _capacity) {
+				_lazy[index] = Action::compose(f, _lazy[index]);
+			}
+		}
+
+		void _push(::std::size_t index) {
+			_apply_all(index << 1, _lazy[index]);
+			_apply_all(index << 1 | 1, _lazy[index]);
+			_lazy[index] = Action::identity;
+		}
+
+		void _push_boundary(::std::size_t first, ::std::size_t last) {
+			for (int i{_log}; i != 0; --i) {
+				if (((first >> i) << i) != first) {
+					_push(first >> i);
+				}
+				if (((last >> i) << i) != last) {
+					_push((last - 1) >> i);
+				}
+			}
+		}
+
+		void _push_path(::std::size_t index) {
+			for (int i{_log}; i != 0; --i) {
+				_push(index >> i);
+			}
+		}
+
+		void _update_path(::std::size_t index) {
+			while (index >>= 1) {
+				_update(index);
+			}
+		}
+
+	public:
+		explicit lazy_segment_tree(::std::size_t size) :
+			_size{size},
+			_capacity{::concrete::bit_ceil(size)},
+			_log{::concrete::countr_zero(_capacity)},
+			_data(_capacity << 1, traits::identity),
+			_lazy(_capacity, Action::identity) {}
+
+		template<class input_iterator>
+		explicit lazy_segment_tree(input_iterator first, input_iterator last) : lazy_segment_tree(::std::vector<T>(first, last)) {}
+
+		explicit lazy_segment_tree(const ::std::vector<T>& values) : lazy_segment_tree(values.size()) {
+			::std::copy(values.begin(), values.end(), _data.begin() + _capacity);
+			for (::std::size_t i{_capacity - 1}; i != 0; --i) {
+				_update(i);
+			}
+		}
+
+		::std::size_t size() const noexcept {
+			return _size;
+		}
+
+		T operator[](::std::size_t index) {
+			index += _capacity;
+			_push_path(index);
+			return _data[index];
+		}
+
+		void set(::std::size_t index, const T& value) {
+			index += _capacity;
+			_push_path(index);
+			_data[index] = value;
+			_update_path(index);
+		}
+
+		void apply(::std::size_t index, const F& f) {
+			index += _capacity;
+			_push_path(index);
+			_data[index] = Action::apply(f, _data[index], 1);
+			_update_path(index);
+		}
+
+		void apply(::std::size_t first, ::std::size_t last, const F& f) {
+			if (first == last) {
+				return;
+			}
+			first += _capacity;
+			last += _capacity;
+			_push_boundary(first, last);
+			for (::std::size_t l{first}, r{last}; l < r; l >>= 1, r >>= 1) {
+				if (l & 1) {
+					_apply_all(l++, f);
+				}
+				if (r & 1) {
+					_apply_all(--r, f);
+				}
+			}
+			for (int i{1}; i <= _log; ++i) {
+				if (((first >> i) << i) != first) {
+					_update(first >> i);
+				}
+				if (((last >> i) << i) != last) {
+					_update((last - 1) >> i);
+				}
+			}
+		}
+
+		T query(::std::size_t first, ::std::size_t last) {
+			if (first == last) {
+				return traits::identity;
+			}
+			first += _capacity;
+			last += _capacity;
+			_push_boundary(first, last);
+			if constexpr (traits::commutative) {
+				T res{traits::identity};
+				while (first < last) {
+					if (first & 1) {
+						res = _op(res, _data[first++]);
+					}
+					if (last & 1) {
+						res = _op(res, _data[--last]);
+					}
+					first >>= 1;
+					last >>= 1;
+				}
+				return res;
+			}
+			else {
+				T left{traits::identity}, right{traits::identity};
+				while (first < last) {
+					if (first & 1) {
+						left = _op(left, _data[first++]);
+					}
+					if (last & 1) {
+						right = _op(_data[--last], right);
+					}
+					first >>= 1;
+					last >>= 1;
+				}
+				return _op(left, right);
+			}
+		}
+
+		T query() const noexcept {
+			return _data[1];
+		}
+
+		template<class Pred>
+		::std::size_t max_right(::std::size_t first, Pred pred) {
+			if (first == _size) {
+				return _size;
+			}
+			first += _capacity;
+			_push_path(first);
+			T sum{traits::identity};
+			do {
+				first >>= ::concrete::countr_zero(first);
+				if (!pred(_op(sum, _data[first]))) {
+					while (first < _capacity) {
+						_push(first);
+						first <<= 1;
+						if (T t{_op(sum, _data[first])}; pred(t)) {
+							sum = t;
+							++first;
+						}
+					}
+					return first - _capacity;
+				}
+				sum = _op(sum, _data[first++]);
+			} while (!::concrete::has_single_bit(first));
+			return _size;
+		}
+
+		template<class Pred>
+		::std::size_t min_left(::std::size_t last, Pred pred) {
+			if (last == 0) {
+				return 0;
+			}
+			last += _capacity;
+			_push_path(last - 1);
+			T sum{traits::identity};
+			do {
+				--last;
+				while (last > 1 && (last & 1)) {
+					last >>= 1;
+				}
+				if (!pred(_op(_data[last], sum))) {
+					while (last < _capacity) {
+						_push(last);
+						last = last << 1 | 1;
+						if (T t{_op(_data[last], sum)}; pred(t)) {
+							sum = t;
+							--last;
+						}
+					}
+					return last + 1 - _capacity;
+				}
+				sum = _op(_data[last], sum);
+			} while (!::concrete::has_single_bit(last));
+			return 0;
+		}
+	};
+
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "matrix.h"
+#include "operator.h"
+
+namespace concrete {
+
+	namespace detail {
+
+		namespace semiring {
+
+			constexpr ::std::size_t tile_rows{32};
+			constexpr ::std::size_t tile_depth{128};
+			constexpr ::std::size_t tile_cols{512};
+
+			template<class Add, class Mul, class T>
+			void multiply_add_tile(const T* x, const T* y, T* z,
+				::std::size_t xStride, ::std::size_t yStride, ::std::size_t zStride,
+				::std::size_t rows, ::std::size_t depth, ::std::size_t cols) noexcept {
+				using traits = ::concrete::semiring_traits<Add, Mul>;
+				constexpr Add add{};
+				constexpr Mul mul{};
+				for (::std::size_t i{0}; i != rows; ++i) {
+					T* zRow{z + i * zStride};
+					for (::std::size_t k{0}; k != depth; ++k) {
+						T xik{x[i * xStride + k]};
+						if (xik == traits::zero) {
+							continue;
+						}
+						const T* yRow{y + k * yStride};
+						if (add(mul(xik, traits::zero), traits::zero) == traits::zero) {
+							for (::std::size_t j{0}; j != cols; ++j) {
+								zRow[j] = add(zRow[j], mul(xik, yRow[j]));
+							}
+						}
+						else {
+							for (::std::size_t j{0}; j != cols; ++j) {
+								zRow[j] = add(zRow[j], yRow[j] == traits::zero ? traits::zero : mul(xik, yRow[j]));
+							}
+						}
+					}
+				}
+			}
+
+			template<class Add, class Mul, class T>
+			void multiply_add(const T* x, const T* y, T* z,
+				::std::size_t xStride, ::std::size_t yStride, ::std::size_t zStride,
+				::std::size_t rows, ::std::size_t depth, ::std::size_t cols) noexcept {
+				for (::std::size_t i{0}; i < rows; i += tile_rows) {
+					::std::size_t r{rows - i < tile_rows ? rows - i : tile_rows};
+					for (::std::size_t k{0}; k < depth; k += tile_depth) {
+						::std::size_t d{depth - k < tile_depth ? depth - k : tile_depth};
+						for (::std::size_t j{0}; j < cols; j += tile_cols) {
+							::std::size_t c{cols - j < tile_cols ? cols - j : tile_cols};
+							multiply_add_tile<Add, Mul>(x + i * xStride + k, y + k * yStride + j, z + i * zStride + j, xStride, yStride, zStride, r, d, c);
+						}
+					}
+				}
+			}
+
+		}
+
+	}
+
+	template<class Add, class Mul, class T>
+	::concrete::matrix<T> semiring_multiply(const ::concrete::matrix<T>& x, const ::concrete::matrix<T>& y) {
+		static_assert(::concrete::is_semiring_v<Add, Mul>, "Add and Mul should form a semiring.");
+
+		::std::size_t rows{x.row_count()}, depth{x.col_count()}, cols{y.col_count()};
+		::concrete::matrix<T> res(rows, cols, ::concrete::semiring_traits<Add, Mul>::zero);
+		::concrete::detail::semiring::multiply_add<Add, Mul>(x.data(), y.data(), res.data(), depth, cols, cols, rows, depth, cols);
+		return res;
+	}
+
+	template<class Add, class Mul, class T>
+	void semiring_closure(::concrete::matrix<T>& x) {
+		static_assert(::concrete::is_semiring_v<Add, Mul> && ::concrete::algebraic_traits<Add>::idempotent,
+			"Add and Mul should form a semiring with idempotent addition.");
+
+		using namespace ::concrete::detail::semiring;
+		using traits = ::concrete::semiring_traits<Add, Mul>;
+		constexpr Add add{};
+		constexpr ::std::size_t block{64};
+
+		::std::size_t n{x.row_count()};
+		T* data{x.data()};
+		for (::std::size_t i{0}; i != n; ++i) {
+			data[i * n + i] = add(data[i * n + i], traits::one);
+		}
+		auto relax{[&](::std::size_t i, ::std::size_t r, ::std::size_t k, ::std::size_t d, ::std::size_t j, ::std::size_t c) {
+			for (::std::size_t t{0}; t != d; ++t) {
+				multiply_add_tile<Add, Mul>(data + i * n + k + t, data + (k + t) * n + j, data + i * n + j, n, n, n, r, 1, c);
+			}
+		}};
+		for (::std::size_t k{0}; k < n; k += block) {
+			::std::size_t d{n - k < block ? n - k : block};
+			relax(k, d, k, d, k, d);
+			for (::std::size_t j{0}; j < n; j += block) {
+				if (j != k) {
+					relax(k, d, k, d, j, n - j < block ? n - j : block);
+				}
+			}
+			for (::std::size_t i{0}; i < n; i += block) {
+				if (i != k) {
+					relax(i, n - i < block ? n - i : block, k, d, k, d);
+				}
+			}
+			for (::std::size_t i{0}; i < n; i += block) {
+				if (i != k) {
+					multiply_add<Add, Mul>(data + i * n + k, data + k * n, data + i * n, n, n, n, n - i < block ? n - i : block, d, k);
+					if (k + d < n) {
+						multiply_add<Add, Mul>(data + i * n + k, data + k * n + k + d, data + i * n + k + d, n, n, n, n - i < block ? n - i : block, d, n - k - d);
+					}
+				}
+			}
+		}
+	}
+
+}
\ No newline at end of file
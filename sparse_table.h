@@ -0,0 +1,185 @@
+#pragma once
+
+#include "operator.h"
+#include "standard.h"
+
+#include <type_traits>
+#include <vector>
+
+namespace concrete {
+
+	template<class T, class Op>
+	class sparse_table {
+		static_assert(::concrete::is_semigroup_v<Op> && ::concrete::algebraic_traits<Op>::idempotent,
+			"Op should be an idempotent semigroup.");
+
+		static constexpr Op _op{};
+
+		::std::size_t _size;
+		::std::vector<T> _data;
+
+		const T& _at(int level, ::std::size_t index) const noexcept {
+			return _data[level * _size + index];
+		}
+
+	public:
+		template<class input_iterator>
+		explicit sparse_table(input_iterator first, input_iterator last) : _data(first, last) {
+			_size = _data.size();
+			int levels{::concrete::bit_width(_size)};
+			_data.resize(_size * (levels == 0 ? 1 : levels));
+			for (int k{1}; k < levels; ++k) {
+				::std::size_t half{::std::size_t{1} << (k - 1)};
+				for (::std::size_t i{0}; i + (half << 1) <= _size; ++i) {
+					_data[k * _size + i] = _op(_at(k - 1, i), _at(k - 1, i + half));
+				}
+			}
+		}
+
+		::std::size_t size() const noexcept {
+			return _size;
+		}
+
+		const T& operator[](::std::size_t index) const noexcept {
+			return _data[index];
+		}
+
+		T query(::std::size_t first, ::std::size_t last) const noexcept {
+			::std::size_t length{last - first};
+			int k{::concrete::bit_width(length) - 1};
+			return _op(_at(k, first), _at(k, last - ::concrete::bit_floor(length)));
+		}
+	};
+
+	template<class T, class Op>
+	class disjoint_sparse_table {
+		static_assert(::concrete::is_semigroup_v<Op>, "Op should be associative.");
+
+		static constexpr Op _op{};
+
+		::std::size_t _size;
+		::std::vector<T> _data;
+
+		const T& _at(int level, ::std::size_t index) const noexcept {
+			return _data[level * _size + index];
+		}
+
+		T& _at(int level, ::std::size_t index) noexcept {
+			return _data[level * _size + index];
+		}
+
+	public:
+		template<class input_iterator>
+		explicit disjoint_sparse_table(input_iterator first, input_iterator last) : _data(first, last) {
+			_size = _data.size();
+			int levels{_size <= 1 ? 1 : ::concrete::bit_width(_size - 1) + 1};
+			_data.resize(_size * levels);
+			for (int k{1}; k < levels; ++k) {
+				::std::size_t half{::std::size_t{1} << (k - 1)};
+				for (::std::size_t mid{half}; mid < _size; mid += half << 1) {
+					_at(k, mid - 1) = _at(0, mid - 1);
+					for (::std::size_t i{mid - 1}; i != mid - half; --i) {
+						_at(k, i - 1) = _op(_at(0, i - 1), _at(k, i));
+					}
+					_at(k, mid) = _at(0, mid);
+					for (::std::size_t i{mid + 1}; i != mid + half && i != _size; ++i) {
+						_at(k, i) = _op(_at(k, i - 1), _at(0, i));
+					}
+				}
+			}
+		}
+
+		::std::size_t size() const noexcept {
+			return _size;
+		}
+
+		const T& operator[](::std::size_t index) const noexcept {
+			return _data[index];
+		}
+
+		T query(::std::size_t first, ::std::size_t last) const noexcept {
+			--last;
+			if (first == last) {
+				return _at(0, first);
+			}
+			int k{::concrete::bit_width(first ^ last)};
+			return _op(_at(k, first), _at(k, last));
+		}
+	};
+
+	template<class T, class Op>
+	class block_sparse_table {
+		static_assert(::concrete::is_semigroup_v<Op>, "Op should be associative.");
+
+		using summary_type = ::std::conditional_t<::concrete::algebraic_traits<Op>::idempotent,
+			::concrete::sparse_table<T, Op>, ::concrete::disjoint_sparse_table<T, Op>>;
+
+		static constexpr Op _op{};
+
+		int _shift;
+		::std::vector<T> _data, _prefix, _suffix;
+		summary_type _summary;
+
+		static int _block_shift(::std::size_t size) noexcept {
+			return ::concrete::bit_width((unsigned)::concrete::bit_width(size));
+		}
+
+		explicit block_sparse_table(::std::vector<T> values) :
+			_shift{_block_shift(values.size())},
+			_data{::std::move(values)},
+			_prefix{_data},
+			_suffix{_data},
+			_summary{_build()} {}
+
+		summary_type _build() {
+			::std::size_t size{_data.size()};
+			::std::size_t block{::std::size_t{1} << _shift};
+			::std::vector<T> summary;
+			summary.reserve((size + block - 1) >> _shift);
+			for (::std::size_t first{0}; first < size; first += block) {
+				::std::size_t last{first + block < size ? first + block : size};
+				for (::std::size_t i{first + 1}; i != last; ++i) {
+					_prefix[i] = _op(_prefix[i - 1], _data[i]);
+				}
+				for (::std::size_t i{last - 1}; i != first; --i) {
+					_suffix[i - 1] = _op(_data[i - 1], _suffix[i]);
+				}
+				summary.push_back(_prefix[last - 1]);
+			}
+			return summary_type{summary.begin(), summary.end()};
+		}
+
+	public:
+		template<class input_iterator>
+		explicit block_sparse_table(input_iterator first, input_iterator last) : block_sparse_table(::std::vector<T>(first, last)) {}
+
+		::std::size_t size() const noexcept {
+			return _data.size();
+		}
+
+		const T& operator[](::std::size_t index) const noexcept {
+			return _data[index];
+		}
+
+		T query(::std::size_t first, ::std::size_t last) const noexcept {
+			--last;
+			::std::size_t firstBlock{first >> _shift}, lastBlock{last >> _shift};
+			if (firstBlock == lastBlock) {
+				if ((first & ((::std::size_t{1} << _shift) - 1)) == 0) {
+					return _prefix[last];
+				}
+				T res{_data[first]};
+				while (first != last) {
+					res = _op(res, _data[++first]);
+				}
+				return res;
+			}
+			T res{_suffix[first]};
+			if (lastBlock - firstBlock > 1) {
+				res = _op(res, _summary.query(firstBlock + 1, lastBlock));
+			}
+			return _op(res, _prefix[last]);
+		}
+	};
+
+}
\ No newline at end of file
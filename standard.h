@@ -1,10 +1,16 @@
 #pragma once
 
 #include <climits>
+#include <cstdlib>
+#include <initializer_list>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 #ifdef _MSC_VER
 #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
 #endif
 
 namespace concrete {
@@ -124,4 +130,253 @@ namespace concrete {
 		return T{1} << (::concrete::bit_width(x) - 1);
 	}
 
+	template<class T>
+	constexpr int popcount(T x) noexcept {
+		constexpr int bit{sizeof(T) * CHAR_BIT};
+		constexpr int bitu{sizeof(unsigned) * CHAR_BIT};
+		constexpr int bitul{sizeof(unsigned long) * CHAR_BIT};
+		constexpr int bitull{sizeof(unsigned long long) * CHAR_BIT};
+
+		if constexpr (bit > bitull) {
+			static_assert(bit <= 2 * bitull, "T should be at most twice as wide as unsigned long long.");
+
+			return ::concrete::popcount((unsigned long long)x) + ::concrete::popcount((unsigned long long)(x >> bitull));
+		} else {
+			using U = ::std::make_unsigned_t<T>;
+
+			if (::concrete::is_constant_evaluated()) {
+				U y{(U)x};
+				int res{};
+				while (y != 0) {
+					y &= y - 1;
+					++res;
+				}
+				return res;
+			}
+
+#ifdef _MSC_VER
+			unsigned long long y{(U)x};
+			y -= y >> 1 & 0x5555555555555555ull;
+			y = (y & 0x3333333333333333ull) + (y >> 2 & 0x3333333333333333ull);
+			y = (y + (y >> 4)) & 0x0f0f0f0f0f0f0f0full;
+			return (int)(y * 0x0101010101010101ull >> 56);
+#else
+			if constexpr (bit <= bitu) {
+				return __builtin_popcount((U)x);
+			}
+			if constexpr (bit <= bitul) {
+				return __builtin_popcountl((U)x);
+			}
+			return __builtin_popcountll((U)x);
+#endif
+		}
+	}
+
+	template<class T>
+	constexpr T rotl(T x, int s) noexcept {
+		static_assert((T)-1 > T{0}, "T should be an unsigned integral type.");
+
+		constexpr int bit{sizeof(T) * CHAR_BIT};
+		int r{(s % bit + bit) % bit};
+		if (r == 0) {
+			return x;
+		}
+		return (T)(x << r | x >> (bit - r));
+	}
+
+	template<class T>
+	constexpr T rotr(T x, int s) noexcept {
+		static_assert((T)-1 > T{0}, "T should be an unsigned integral type.");
+
+		constexpr int bit{sizeof(T) * CHAR_BIT};
+		int r{(s % bit + bit) % bit};
+		if (r == 0) {
+			return x;
+		}
+		return (T)(x >> r | x << (bit - r));
+	}
+
+	template<class T>
+	constexpr T byteswap(T x) noexcept {
+		using U = ::std::make_unsigned_t<T>;
+
+		if constexpr (sizeof(T) == 1) {
+			return x;
+		}
+
+		if (::concrete::is_constant_evaluated()) {
+			U y{(U)x}, res{0};
+			for (::std::size_t i{0}; i != sizeof(T); ++i) {
+				res = (U)(res << CHAR_BIT | (y & 0xff));
+				y >>= CHAR_BIT;
+			}
+			return (T)res;
+		}
+
+#ifdef _MSC_VER
+		if constexpr (sizeof(T) == 2) {
+			return (T)_byteswap_ushort((U)x);
+		}
+		if constexpr (sizeof(T) == 4) {
+			return (T)_byteswap_ulong((U)x);
+		}
+		return (T)_byteswap_uint64((U)x);
+#else
+		if constexpr (sizeof(T) == 2) {
+			return (T)__builtin_bswap16((U)x);
+		}
+		if constexpr (sizeof(T) == 4) {
+			return (T)__builtin_bswap32((U)x);
+		}
+		return (T)__builtin_bswap64((U)x);
+#endif
+	}
+
+	enum class isa : int {
+		generic,
+		sse42,
+		avx2,
+		avx512
+	};
+
+	namespace detail {
+
+		namespace cpu {
+
+			struct registers {
+				unsigned eax, ebx, ecx, edx;
+			};
+
+			inline registers cpuid(unsigned leaf, unsigned subleaf) noexcept {
+				registers res{};
+#ifdef _MSC_VER
+				int info[4]{};
+				__cpuidex(info, (int)leaf, (int)subleaf);
+				res = {(unsigned)info[0], (unsigned)info[1], (unsigned)info[2], (unsigned)info[3]};
+#elif defined(__x86_64__) || defined(__i386__)
+				if (leaf > __get_cpuid_max(leaf & 0x80000000u, nullptr)) {
+					return res;
+				}
+				__cpuid_count(leaf, subleaf, res.eax, res.ebx, res.ecx, res.edx);
+#endif
+				return res;
+			}
+
+			inline unsigned long long xgetbv() noexcept {
+#ifdef _MSC_VER
+				return _xgetbv(0);
+#elif defined(__x86_64__) || defined(__i386__)
+				unsigned eax{}, edx{};
+				__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+				return (unsigned long long)edx << 32 | eax;
+#else
+				return 0;
+#endif
+			}
+
+			constexpr bool has_bits(unsigned x, unsigned mask) noexcept {
+				return (x & mask) == mask;
+			}
+
+			inline ::concrete::isa detect() noexcept {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+				registers basic{cpuid(1, 0)};
+				if (!has_bits(basic.ecx, 1u << 20 | 1u << 23)) {
+					return ::concrete::isa::generic;
+				}
+				if (!has_bits(basic.ecx, 1u << 12 | 1u << 27 | 1u << 28) || !has_bits((unsigned)xgetbv(), 0x6)) {
+					return ::concrete::isa::sse42;
+				}
+				registers extended{cpuid(7, 0)};
+				registers amd{cpuid(0x80000001u, 0)};
+				if (!has_bits(extended.ebx, 1u << 3 | 1u << 5 | 1u << 8) || !has_bits(amd.ecx, 1u << 5)) {
+					return ::concrete::isa::sse42;
+				}
+				if (!has_bits(extended.ebx, 1u << 16 | 1u << 17 | 1u << 30 | 1u << 31) || !has_bits((unsigned)xgetbv(), 0xe6)) {
+					return ::concrete::isa::avx2;
+				}
+				return ::concrete::isa::avx512;
+#else
+				return ::concrete::isa::generic;
+#endif
+			}
+
+			inline ::concrete::isa parse(::std::string_view name, ::concrete::isa fallback) noexcept {
+				constexpr ::std::string_view names[]{"generic", "sse42", "avx2", "avx512"};
+				for (int i{0}; i != 4; ++i) {
+					if (name == names[i]) {
+						return (::concrete::isa)i;
+					}
+				}
+				return fallback;
+			}
+
+			inline ::concrete::isa resolve() noexcept {
+				::concrete::isa detected{detect()}, res{detected};
+#ifdef _MSC_VER
+				char* value{};
+				if (_dupenv_s(&value, nullptr, "CONCRETE_ISA") == 0 && value != nullptr) {
+					res = parse(value, detected);
+					::std::free(value);
+				}
+#else
+				if (const char* value{::std::getenv("CONCRETE_ISA")}; value != nullptr) {
+					res = parse(value, detected);
+				}
+#endif
+				return res < detected ? res : detected;
+			}
+
+		}
+
+	}
+
+	inline ::concrete::isa detected_isa() noexcept {
+		static const ::concrete::isa res{::concrete::detail::cpu::detect()};
+		return res;
+	}
+
+	inline ::concrete::isa active_isa() noexcept {
+		static const ::concrete::isa res{::concrete::detail::cpu::resolve()};
+		return res;
+	}
+
+	template<class Fn>
+	class dispatch;
+
+	template<class R, class... Args>
+	class dispatch<R(Args...)> {
+	public:
+		using function_type = R(*)(Args...);
+
+	private:
+		function_type _function;
+		::concrete::isa _isa;
+
+	public:
+		dispatch(::std::initializer_list<::std::pair<::concrete::isa, function_type>> candidates) noexcept :
+			_function{nullptr},
+			_isa{::concrete::isa::generic} {
+			::concrete::isa limit{::concrete::active_isa()};
+			for (auto& [level, function] : candidates) {
+				if (level <= limit && (_function == nullptr || level >= _isa)) {
+					_function = function;
+					_isa = level;
+				}
+			}
+		}
+
+		::concrete::isa selected() const noexcept {
+			return _isa;
+		}
+
+		function_type get() const noexcept {
+			return _function;
+		}
+
+		R operator()(Args... args) const {
+			return _function(::std::forward<Args>(args)...);
+		}
+	};
+
 }
\ No newline at end of file
@@ -1,129 +1,2519 @@
+#include "big_integer.h"
+#include "bit_vector.h"
+#include "convolution.h"
+#include "fast_io.h"
+#include "fenwick_tree.h"
+#include "hash_map.h"
+#include "int_m.h"
+#include "linear_recurrence.h"
 #include "math.h"
+#include "matrix.h"
+#include "numeric.h"
+#include "random.h"
+#include "rolling_hash.h"
+#include "segment_tree.h"
+#include "semiring.h"
+#include "sparse_table.h"
+#include "standard.h"
 
-#include <iostream>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory_resource>
+#include <optional>
+#include <random>
 #include <sstream>
-#include <algorithm>
+#include <string>
+#include <thread>
 #include <vector>
 
-template<class function>
-void test(const std::string& label, function func, const std::string& expected) {
-	std::ostringstream stream;
-	auto buffer{std::cout.rdbuf()};
-	auto flags{std::cout.flags()};
+namespace harness {
+
+	using u64 = concrete::uint64_t;
+	using u128 = concrete::uint128_t;
+
+	u64 seed{0x5eed5eed5eed5eedull};
+	double scale{1.0};
+	int failures{0};
+
+	std::size_t count(std::size_t base) {
+		return std::max<std::size_t>(1, (std::size_t)(base * scale));
+	}
+
+	class generator {
+		std::mt19937_64 _engine;
+
+	public:
+		explicit generator(const std::string& label) : _engine{seed ^ std::hash<std::string>{}(label)} {}
+
+		u64 operator()() {
+			return _engine();
+		}
+
+		u64 bits(int n) {
+			return n >= 64 ? _engine() : _engine() & ((u64{1} << n) - 1);
+		}
+
+		u64 below(u64 n) {
+			return _engine() % n;
+		}
+
+		u64 any() {
+			return bits(1 + (int)below(64));
+		}
+	};
+
+	std::string describe(u64 x) {
+		return std::to_string(x);
+	}
+
+	template<std::size_t n>
+	std::string describe(const std::array<u64, n>& x) {
+		std::string res{"("};
+		for (std::size_t i{0}; i != n; ++i) {
+			res += (i == 0 ? "" : ", ") + std::to_string(x[i]);
+		}
+		return res + ")";
+	}
+
+	struct affine {
+		u64 a, b;
+
+		bool operator==(const affine& x) const noexcept {
+			return a == x.a && b == x.b;
+		}
+	};
+
+	struct compose {
+		constexpr affine operator()(const affine& f, const affine& g) const noexcept {
+			return {f.a * g.a, f.b * g.a + g.b};
+		}
+	};
+
+	struct midpoint {
+		constexpr u64 operator()(u64 x, u64 y) const noexcept {
+			return (x >> 1) + (y >> 1) + (x & y & 1);
+		}
+	};
+
+	u64 fold(u64 x) {
+		return x;
+	}
+
+	u64 fold(u128 x) {
+		return (u64)x * 0x9e3779b97f4a7c15ull ^ (u64)(x >> 64);
+	}
+
+	u64 fold(const affine& x) {
+		return x.a * 0x9e3779b97f4a7c15ull ^ x.b;
+	}
+
+	template<auto m>
+	u64 fold(concrete::int_m<m> x) {
+		return (u64)(typename concrete::int_m<m>::value_type)x;
+	}
+
+	template<class T>
+	u64 fold(const std::vector<T>& x) {
+		u64 res{x.size()};
+		for (const T& v : x) {
+			res = res * 0x100000001b3ull ^ fold(v);
+		}
+		return res;
+	}
+
+	template<class Input, class Fast, class Naive>
+	void differential(const std::string& label, const std::vector<Input>& inputs, Fast fast, Naive naive) {
+		using result_type = decltype(fast(inputs[0]));
+		std::vector<result_type> actual;
+		actual.reserve(inputs.size());
+
+		auto begin{std::chrono::steady_clock::now()};
+		for (const Input& x : inputs) {
+			actual.push_back(fast(x));
+		}
+		double seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count()};
+
+		std::size_t mismatches{0};
+		std::ostringstream details;
+		for (std::size_t i{0}; i != inputs.size(); ++i) {
+			auto expected{naive(inputs[i])};
+			if (actual[i] != expected) {
+				if (++mismatches <= 3) {
+					details << "  input " << describe(inputs[i]) << ": expected " << +expected << ", actual " << +actual[i] << '\n';
+				}
+			}
+		}
+
+		static constexpr auto reset{"\033[m"}, red{"\033[31m"}, green{"\033[32m"};
+		std::cout << std::left << (mismatches == 0 ? green : red) << std::setw(44) << label
+			<< (mismatches == 0 ? "Test Passed" : "Test Failed") << reset
+			<< std::right << std::setw(12) << inputs.size() << " cases"
+			<< std::setw(12) << std::fixed << std::setprecision(2) << inputs.size() / seconds * 1e-6 << " Mop/s\n";
+		if (mismatches != 0) {
+			std::cout << details.str() << "  " << mismatches << " mismatches\n";
+			++failures;
+		}
+	}
+
+}
+
+namespace concrete {
+
+	template<>
+	struct algebraic_traits<harness::compose> {
+		static constexpr bool associative{true};
+		static constexpr harness::affine identity{1, 0};
+		static constexpr bool invertible{false};
+		static constexpr bool commutative{false};
+		static constexpr bool idempotent{false};
+		using algebraic_structure_tag = ::concrete::monoid_tag;
+	};
+
+	template<>
+	struct algebraic_traits<harness::midpoint> {
+		static constexpr bool associative{false};
+		static constexpr bool invertible{false};
+		static constexpr bool commutative{true};
+		static constexpr bool idempotent{true};
+		using algebraic_structure_tag = ::concrete::magma_tag;
+	};
+
+}
+
+namespace reference {
+
+	using harness::u64;
+	using harness::u128;
+
+	u64 square_root(u64 x) {
+		u64 lo{0}, hi{u64{1} << 32};
+		while (hi - lo > 1) {
+			u64 mid{lo + (hi - lo) / 2};
+			if ((u128)mid * mid <= x) {
+				lo = mid;
+			}
+			else {
+				hi = mid;
+			}
+		}
+		return lo;
+	}
 
-	std::cout.rdbuf(stream.rdbuf());
-	func();
-	std::cout.rdbuf(buffer);
-	std::cout.flags(flags);
-	std::string actual{stream.str()};
+	u64 power(u64 x, u64 y) {
+		u64 res{1};
+		for (; y != 0; y >>= 1, x *= x) {
+			if (y & 1) {
+				res *= x;
+			}
+		}
+		return res;
+	}
 
-	auto p1{std::find_if_not(actual.begin(), actual.end(), std::isspace)}, e1{actual.end()};
-	auto p2{std::find_if_not(expected.begin(), expected.end(), std::isspace)}, e2{expected.end()};
+	u64 greatest_common_divisor(u64 x, u64 y) {
+		while (y != 0) {
+			u64 t{x % y};
+			x = y;
+			y = t;
+		}
+		return x;
+	}
 
-	do {
-		auto n1{std::find_if_not(p1, e1, std::isspace)};
-		auto n2{std::find_if_not(p2, e2, std::isspace)};
-		if ((p1 == n1) != (p2 == n2)) {
-			break;
+	int kronecker_symbol(u64 a, u64 b) {
+		if (b == 0) {
+			return a == 1;
+		}
+		if (a % 2 == 0 && b % 2 == 0) {
+			return 0;
+		}
+		int k{1};
+		while (b % 2 == 0) {
+			b /= 2;
+			if (a % 8 == 3 || a % 8 == 5) {
+				k = -k;
+			}
 		}
-		p1 = n1;
-		p2 = n2;
-	} while (p1 != e1 && p2 != e2 && *p1++ == *p2++);
-	p1 = std::find_if_not(p1, e1, std::isspace);
-	p2 = std::find_if_not(p2, e2, std::isspace);
+		a %= b;
+		while (a != 0) {
+			while (a % 2 == 0) {
+				a /= 2;
+				if (b % 8 == 3 || b % 8 == 5) {
+					k = -k;
+				}
+			}
+			std::swap(a, b);
+			if (a % 4 == 3 && b % 4 == 3) {
+				k = -k;
+			}
+			a %= b;
+		}
+		return b == 1 ? k : 0;
+	}
 
-	static constexpr auto reset{"\033[m"}, red{"\033[31m"}, green{"\033[32m"}, yellow{"\033[33m"};
-	std::size_t space{std::max(label.size() + 1, std::size_t{36})};
+	u64 multiply(u64 x, u64 y, u64 m) {
+		return (u64)((u128)x * y % m);
+	}
+
+	u64 power(u64 x, u64 y, u64 m) {
+		u64 res{1 % m};
+		for (x %= m; y != 0; y >>= 1, x = multiply(x, x, m)) {
+			if (y & 1) {
+				res = multiply(res, x, m);
+			}
+		}
+		return res;
+	}
 
-	std::cout << std::left;
-	if (p1 == e1 && p2 == e2) {
-		std::cout << green << std::setw(space) << label << "Test Passed\n" << reset;
+	bool is_prime(u64 x) {
+		if (x < 2) {
+			return false;
+		}
+		for (u64 p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+			if (x % p == 0) {
+				return x == p;
+			}
+		}
+		u64 d{x - 1};
+		int s{0};
+		while (d % 2 == 0) {
+			d /= 2;
+			++s;
+		}
+		for (u64 a : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37}) {
+			u64 t{power(a, d, x)};
+			if (t == 1 || t == x - 1) {
+				continue;
+			}
+			bool composite{true};
+			for (int r{1}; r < s && composite; ++r) {
+				t = multiply(t, t, x);
+				composite = t != x - 1;
+			}
+			if (composite) {
+				return false;
+			}
+		}
+		return true;
 	}
-	else {
-		std::cout << red << std::setw(space) << label << "Test Failed\n"
-			<< yellow << "[Expected Output]\n" << reset << expected << '\n'
-			<< yellow << "[Actual Output]\n" << reset << actual << '\n';
+
+	std::vector<bool> sieve(std::size_t n) {
+		std::vector<bool> res(n, true);
+		res[0] = false;
+		if (n > 1) {
+			res[1] = false;
+		}
+		for (std::size_t i{2}; i * i < n; ++i) {
+			if (res[i]) {
+				for (std::size_t j{i * i}; j < n; j += i) {
+					res[j] = false;
+				}
+			}
+		}
+		return res;
 	}
-	std::cout.flags(flags);
+
 }
 
 namespace math_test {
 
-	void sqrt() {
-		std::vector<std::uint64_t> a{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 1182280556, 1078161935, 1727740828, 1988114385, 1915211379};
-		for (auto& i : a) {
-			std::cout << concrete::square_root(i) << ' ';
+	using harness::u64;
+	using pair = std::array<u64, 2>;
+
+	std::vector<u64> edge_values() {
+		std::vector<u64> res;
+		for (int i{0}; i != 64; ++i) {
+			u64 p{u64{1} << i};
+			res.insert(res.end(), {p - 1, p, p + 1});
 		}
+		res.insert(res.end(), {0, ~u64{0}, ~u64{0} - 1, u64{0xffffffff} * 0xffffffff});
+		return res;
 	}
 
-	void pow() {
-		std::vector<std::uint64_t> a{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 3002069754, 3272062159, 2873182719, 2496520859, 3004049190};
-		for (auto& i : a) {
-			std::cout << concrete::power(i, i) << ' ';
+	void square_root() {
+		harness::generator gen{"square_root"};
+		std::vector<u64> inputs{edge_values()};
+		for (std::size_t i{0}; i != harness::count(1 << 20); ++i) {
+			u64 k{gen.bits(32)};
+			inputs.insert(inputs.end(), {gen.any(), k * k, k * k - 1, k * k + 1});
 		}
+		harness::differential("square_root", inputs, [](u64 x) { return concrete::square_root(x); }, reference::square_root);
 	}
 
-	void gcd_lcm() {
-		for (int i{0}; i < 10; ++i) {
-			for (int j{0}; j < 10; ++j) {
-				std::cout << '{'
-					<< concrete::greatest_common_divisor(i, j) << ','
-					<< concrete::least_common_multiple(i, j)
-					<< '}' << ' ';
+	void power() {
+		harness::generator gen{"power"};
+		std::vector<pair> inputs;
+		for (u64 x : edge_values()) {
+			inputs.push_back({x, 0});
+			inputs.push_back({x, 1});
+			inputs.push_back({x, ~u64{0}});
+		}
+		for (std::size_t i{0}; i != harness::count(1 << 20); ++i) {
+			inputs.push_back({gen.any(), gen.below(2) != 0 ? gen.below(80) : gen.any()});
+		}
+		harness::differential("power", inputs, [](const pair& x) { return concrete::power(x[0], x[1]); },
+			[](const pair& x) { return reference::power(x[0], x[1]); });
+	}
+
+	std::vector<pair> random_pairs(const std::string& label) {
+		harness::generator gen{label};
+		std::vector<pair> inputs;
+		std::vector<u64> edges{edge_values()};
+		for (u64 x : {u64{0}, u64{1}, u64{2}, u64{3}, ~u64{0}}) {
+			for (u64 y : edges) {
+				inputs.push_back({x, y});
+				inputs.push_back({y, x});
 			}
-			std::cout << '\n';
 		}
+		for (std::size_t i{0}; i != harness::count(1 << 20); ++i) {
+			u64 g{gen.bits(1 + (int)gen.below(20))};
+			switch (gen.below(3)) {
+			case 0:
+				inputs.push_back({gen.any(), gen.any()});
+				break;
+			case 1:
+				inputs.push_back({gen.bits(40) * g, gen.bits(40) * g});
+				break;
+			default:
+				inputs.push_back({gen.bits(16), gen.any()});
+				break;
+			}
+		}
+		return inputs;
+	}
+
+	void gcd_lcm() {
+		auto inputs{random_pairs("gcd")};
+		harness::differential("greatest_common_divisor", inputs, [](const pair& x) { return concrete::greatest_common_divisor(x[0], x[1]); },
+			[](const pair& x) { return reference::greatest_common_divisor(x[0], x[1]); });
+		harness::differential("least_common_multiple", inputs, [](const pair& x) { return concrete::least_common_multiple(x[0], x[1]); },
+			[](const pair& x) { return x[0] == 0 && x[1] == 0 ? 0 : x[0] / reference::greatest_common_divisor(x[0], x[1]) * x[1]; });
 	}
 
 	void kronecker_symbol() {
-		for (int i{0}; i < 10; ++i) {
-			for (int j{0}; j < 10; ++j) {
-				std::cout << concrete::kronecker_symbol(i, j) << ' ';
+		auto inputs{random_pairs("kronecker_symbol")};
+		for (u64 x{0}; x != 64; ++x) {
+			for (u64 y{0}; y != 64; ++y) {
+				inputs.push_back({x, y});
 			}
-			std::cout << '\n';
 		}
+		harness::differential("kronecker_symbol", inputs, [](const pair& x) { return concrete::kronecker_symbol(x[0], x[1]); },
+			[](const pair& x) { return reference::kronecker_symbol(x[0], x[1]); });
 	}
 
 	void is_prime() {
-		std::vector<std::uint64_t> a{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 4204940309, 4080787278, 3932737873, 2564387963, 2207258474};
-		for (auto& i : a) {
-			std::cout << concrete::is_prime(i) << ' ';
-		}
-	}
-
-	void run() {
-		test("sqrt", sqrt, "0 1 1 1 2 2 2 2 2 3 34384 32835 41566 44588 43763");
-		test("pow", pow, "1 1 4 27 256 3125 46656 823543 16777216 387420489 0 1783393135476470575 15480720596823619071 16371189851142813251 0");
-		test("gcd/lcm", gcd_lcm, R"(
-{0,0}	{1,0}	{2,0}	{3,0}	{4,0}	{5,0}	{6,0}	{7,0}	{8,0}	{9,0}
-{1,0}	{1,1}	{1,2}	{1,3}	{1,4}	{1,5}	{1,6}	{1,7}	{1,8}	{1,9}
-{2,0}	{1,2}	{2,2}	{1,6}	{2,4}	{1,10}	{2,6}	{1,14}	{2,8}	{1,18}
-{3,0}	{1,3}	{1,6}	{3,3}	{1,12}	{1,15}	{3,6}	{1,21}	{1,24}	{3,9}
-{4,0}	{1,4}	{2,4}	{1,12}	{4,4}	{1,20}	{2,12}	{1,28}	{4,8}	{1,36}
-{5,0}	{1,5}	{1,10}	{1,15}	{1,20}	{5,5}	{1,30}	{1,35}	{1,40}	{1,45}
-{6,0}	{1,6}	{2,6}	{3,6}	{2,12}	{1,30}	{6,6}	{1,42}	{2,24}	{3,18}
-{7,0}	{1,7}	{1,14}	{1,21}	{1,28}	{1,35}	{1,42}	{7,7}	{1,56}	{1,63}
-{8,0}	{1,8}	{2,8}	{1,24}	{4,8}	{1,40}	{2,24}	{1,56}	{8,8}	{1,72}
-{9,0}	{1,9}	{1,18}	{3,9}	{1,36}	{1,45}	{3,18}	{1,63}	{1,72}	{9,9}
-)");
-		test("kronecker_symbol", kronecker_symbol, R"(
-0	1	0	0	0	0	0	0	0	0
-1	1	1	1	1	1	1	1	1	1
-0	1	0	-1	0	-1	0	1	0	1
-0	1	-1	0	1	-1	0	-1	-1	0
-0	1	0	1	0	1	0	1	0	1
-0	1	-1	-1	1	0	1	-1	-1	1
-0	1	0	0	0	1	0	-1	0	0
-0	1	1	1	1	-1	1	0	1	1
-0	1	0	-1	0	-1	0	1	0	1
-0	1	1	0	1	1	0	1	1	0
-)");
-		test("is_prime", is_prime, "0 0 1 1 0 1 0 1 0 0 1 0 1 1 0");
-	}
-
-}
-
-//int main() {
-//	math_test::run();
-//}
\ No newline at end of file
+		constexpr std::size_t sieved{1 << 22};
+		std::vector<bool> small{reference::sieve(sieved)};
+		std::vector<u64> exhaustive(sieved);
+		for (std::size_t i{0}; i != sieved; ++i) {
+			exhaustive[i] = i;
+		}
+		harness::differential("is_prime (sieve)", exhaustive, [](u64 x) { return concrete::is_prime(x); }, [&](u64 x) { return (bool)small[x]; });
+
+		harness::generator gen{"is_prime"};
+		std::vector<u64> inputs{edge_values()};
+		inputs.insert(inputs.end(), {561, 1105, 1729, 2047, 1373653, 25326001, 3215031751, 2152302898747, 3474749660383,
+			341550071728321, 3825123056546413051, 9223372036854775783ull, 18446744073709551557ull});
+		for (u64 b : concrete::detail::is_prime::bounds) {
+			for (u64 d{0}; d != harness::count(1 << 14); ++d) {
+				inputs.push_back(b - d);
+				inputs.push_back(b + d);
+			}
+		}
+		for (const auto& primes : concrete::detail::is_prime::primes) {
+			for (u64 p : primes) {
+				inputs.insert(inputs.end(), {p, p * p, p * (p + 2)});
+			}
+		}
+		for (std::size_t i{0}; i != harness::count(1 << 20); ++i) {
+			u64 p{gen.bits(32) | 1};
+			inputs.insert(inputs.end(), {gen.any() | 1, p * (p + 2 * gen.below(1 << 10)), ~u64{0} - 2 * gen.bits(24)});
+		}
+		harness::differential("is_prime", inputs, [](u64 x) { return concrete::is_prime(x); }, reference::is_prime);
+	}
+
+	void run() {
+		square_root();
+		power();
+		gcd_lcm();
+		kronecker_symbol();
+		is_prime();
+	}
+
+}
+
+namespace modular_test {
+
+	using harness::u64;
+	using triple = std::array<u64, 3>;
+
+	template<class T, bool strict = false>
+	void modular_arithmetic(const std::string& label, int limitBits) {
+		harness::generator gen{label};
+		std::vector<u64> moduli{~u64{0} >> (64 - limitBits), (~u64{0} >> (64 - limitBits)) - 2, 3, 5, 1};
+		while (moduli.size() != 64) {
+			moduli.push_back(gen.bits(limitBits) | u64{1} << (limitBits - 1 - gen.below(4)) | 1);
+		}
+		std::vector<concrete::modular_arithmetic<T, strict>> mods;
+		for (u64 m : moduli) {
+			mods.emplace_back((T)m);
+		}
+		std::vector<triple> inputs;
+		for (std::size_t i{0}; i != harness::count(1 << 20); ++i) {
+			u64 k{gen.below(moduli.size())}, m{moduli[k]};
+			auto value{[&]() { u64 r{gen.below(8)}; return r == 0 ? 0 : r == 1 ? m - 1 : r == 2 ? m / 2 : gen.below(m); }};
+			inputs.push_back({k, value(), value()});
+		}
+
+		auto load{[&](const triple& x) { const auto& mod{mods[x[0]]}; return std::array<T, 2>{mod((T)x[1]), mod((T)x[2])}; }};
+		harness::differential(label + " multiply", inputs,
+			[&](const triple& x) { const auto& mod{mods[x[0]]}; auto v{load(x)}; return (u64)mod.to(mod.multiply(v[0], v[1])); },
+			[&](const triple& x) { return reference::multiply(x[1], x[2], moduli[x[0]]); });
+		harness::differential(label + " prepared", inputs,
+			[&](const triple& x) { const auto& mod{mods[x[0]]}; auto v{load(x)}; return (u64)mod.to(mod.multiply(mod.multiply(v[0], v[1]), mod.prepare(v[1]))); },
+			[&](const triple& x) { u64 m{moduli[x[0]]}; return reference::multiply(reference::multiply(x[1], x[2], m), x[2], m); });
+		harness::differential(label + " add/subtract", inputs,
+			[&](const triple& x) { const auto& mod{mods[x[0]]}; auto v{load(x)}; return (u64)mod.to(mod.subtract(mod.add(v[0], v[1]), mod.negate(v[1]))); },
+			[&](const triple& x) { u64 m{moduli[x[0]]}; return (u64)((x[1] + 2 * ((harness::u128)x[2] % m)) % m); });
+		harness::differential(label + " power", inputs,
+			[&](const triple& x) { const auto& mod{mods[x[0]]}; auto v{load(x)}; return (u64)mod.to(mod.power(v[0], (T)x[2])); },
+			[&](const triple& x) { return reference::power(x[1], x[2], moduli[x[0]]); });
+		harness::differential(label + " equal", inputs,
+			[&](const triple& x) { const auto& mod{mods[x[0]]}; auto v{load(x)}; return mod.equal(mod.add(v[0], v[1]), mod.add(v[1], v[0])) && mod.less(v[0], v[1]) == (x[1] < x[2]); },
+			[&](const triple&) { return true; });
+	}
+
+	using u128 = harness::u128;
+	using quintuple = std::array<u64, 5>;
+
+	u128 add(u128 x, u128 y, u128 m) {
+		return x >= m - y ? x - (m - y) : x + y;
+	}
+
+	u128 multiply(u128 x, u128 y, u128 m) {
+		u128 res{0};
+		for (x %= m, y %= m; y != 0; y >>= 1, x = add(x, x, m)) {
+			if (y & 1) {
+				res = add(res, x, m);
+			}
+		}
+		return res;
+	}
+
+	u128 power(u128 x, u64 y, u128 m) {
+		u128 res{1 % m};
+		for (; y != 0; y >>= 1, x = multiply(x, x, m)) {
+			if (y & 1) {
+				res = multiply(res, x, m);
+			}
+		}
+		return res;
+	}
+
+	void modular_arithmetic_128() {
+		using mod_type = concrete::modular_arithmetic<u128>;
+		harness::generator gen{"modular_arithmetic<uint128_t>"};
+		auto wide{[&](int bits) { return bits <= 64 ? (u128)gen.bits(bits) : (u128)gen.bits(bits - 64) << 64 | gen(); }};
+		std::vector<u128> moduli{((u128)1 << 126) - 1, ((u128)1 << 126) - 3, (u128)1 << 64 | 1, ((u128)1 << 64) - 59, 3, 1};
+		while (moduli.size() != 64) {
+			moduli.push_back(wide(126 - (int)gen.below(64)) | (u128)1 << (125 - gen.below(64)) | 1);
+		}
+		std::vector<mod_type> mods;
+		for (u128 m : moduli) {
+			mods.emplace_back(m);
+		}
+		std::vector<quintuple> inputs;
+		for (std::size_t i{0}, n{harness::count(1 << 15)}; i != n; ++i) {
+			u64 k{gen.below(moduli.size())};
+			u128 m{moduli[k]};
+			auto value{[&]() { u64 r{gen.below(8)}; u128 v{r == 0 ? 0 : r == 1 ? m - 1 : r == 2 ? m / 2 : wide(128) % m}; return v; }};
+			u128 x{value()}, y{value()};
+			inputs.push_back({k, (u64)(x >> 64), (u64)x, (u64)(y >> 64), (u64)y});
+		}
+
+		auto unpack{[](const quintuple& x) { return std::array<u128, 2>{(u128)x[1] << 64 | x[2], (u128)x[3] << 64 | x[4]}; }};
+		auto load{[&](const quintuple& x) { const mod_type& mod{mods[x[0]]}; auto v{unpack(x)}; return std::array<u128, 2>{mod(v[0]), mod(v[1])}; }};
+		harness::differential("modular_arithmetic<uint128_t> multiply", inputs,
+			[&](const quintuple& x) { const mod_type& mod{mods[x[0]]}; auto v{load(x)}; return harness::fold(mod.to(mod.multiply(v[0], v[1]))); },
+			[&](const quintuple& x) { auto v{unpack(x)}; return harness::fold(multiply(v[0], v[1], moduli[x[0]])); });
+		harness::differential("modular_arithmetic<uint128_t> prepared", inputs,
+			[&](const quintuple& x) { const mod_type& mod{mods[x[0]]}; auto v{load(x)}; return harness::fold(mod.to(mod.multiply(v[0], mod.prepare(v[1])))); },
+			[&](const quintuple& x) { auto v{unpack(x)}; return harness::fold(multiply(v[0], v[1], moduli[x[0]])); });
+		harness::differential("modular_arithmetic<uint128_t> add/subtract", inputs,
+			[&](const quintuple& x) { const mod_type& mod{mods[x[0]]}; auto v{load(x)}; return harness::fold(mod.to(mod.subtract(mod.add(v[0], v[1]), mod.negate(v[1])))); },
+			[&](const quintuple& x) { u128 m{moduli[x[0]]}; auto v{unpack(x)}; return harness::fold(add(add(v[0], v[1], m), v[1], m)); });
+		harness::differential("modular_arithmetic<uint128_t> power", inputs,
+			[&](const quintuple& x) { const mod_type& mod{mods[x[0]]}; auto v{load(x)}; return harness::fold(mod.to(mod.power(v[0], (u128)(x[4] & 0xFFFF)))); },
+			[&](const quintuple& x) { auto v{unpack(x)}; return harness::fold(power(v[0], x[4] & 0xFFFF, moduli[x[0]])); });
+	}
+
+	template<auto m>
+	constexpr bool is_valid_modulus{concrete::detail::modular::is_montgomery<m>() || concrete::detail::modular::is_pseudo_mersenne<m>()};
+
+	static_assert(!is_valid_modulus<1022u> && !is_valid_modulus<(1ull << 62) - 2> && !is_valid_modulus<(1ull << 63) - 24>,
+		"int_m should reject even moduli.");
+	static_assert(is_valid_modulus<2147483647u> && is_valid_modulus<9223372036854775783ull> && is_valid_modulus<998244353u>);
+
+	template<class X, class Y, class = void>
+	constexpr bool is_multipliable{false};
+
+	template<class X, class Y>
+	constexpr bool is_multipliable<X, Y, std::void_t<decltype(std::declval<X>() * std::declval<Y>())>>{true};
+
+	static_assert(is_multipliable<concrete::int_m<998244353u>, concrete::int_m<998244353u>::constant_type>
+		&& !is_multipliable<concrete::int_m<998244353u>, concrete::int_m<1000000007u>::constant_type>
+		&& !is_multipliable<concrete::int_m<1000000007u>::constant_type, concrete::int_m<998244353u>>,
+		"Prepared constants should only multiply values of the same modulus.");
+
+	template<auto m>
+	void int_m(const std::string& label) {
+		using mint = concrete::int_m<m>;
+		using value_type = typename mint::value_type;
+		harness::generator gen{label};
+		std::vector<triple> inputs;
+		for (std::size_t i{0}; i != harness::count(1 << 20); ++i) {
+			auto value{[&]() { u64 r{gen.below(8)}; return r == 0 ? 0 : r == 1 ? (u64)m - 1 : r == 2 ? 1 : gen.below(m); }};
+			inputs.push_back({value(), value(), value()});
+		}
+		harness::differential(label + " expression", inputs,
+			[](const triple& x) { mint a{(value_type)x[0]}, b{(value_type)x[1]}, c{(value_type)x[2]}; return (u64)(value_type)(a * b + c - a * c); },
+			[](const triple& x) { return (u64)(((harness::u128)reference::multiply(x[0], x[1], m) + x[2] + m - reference::multiply(x[0], x[2], m)) % m); });
+		harness::differential(label + " prepared", inputs,
+			[](const triple& x) { mint a{(value_type)x[0]}, b{(value_type)x[1]}, c{(value_type)x[2]}; return (u64)(value_type)(a * concrete::prepare(b) + concrete::prepare(c) * (a - b)); },
+			[](const triple& x) { return (u64)(((harness::u128)reference::multiply(x[0], x[1], m) + reference::multiply((u64)(((harness::u128)x[0] + m - x[1]) % m), x[2], m)) % m); });
+		harness::differential(label + " divide", inputs,
+			[](const triple& x) { mint a{(value_type)x[0]}, b{(value_type)(x[1] == 0 ? 1 : x[1])}; return (u64)(value_type)(a / b); },
+			[](const triple& x) { return reference::multiply(x[0], reference::power(x[1] == 0 ? 1 : x[1], m - 2, m), m); });
+	}
+
+	void run() {
+		modular_arithmetic<concrete::uint32_t>("modular_arithmetic<uint32_t>", 30);
+		modular_arithmetic<concrete::uint64_t>("modular_arithmetic<uint64_t>", 62);
+		modular_arithmetic<concrete::uint64_t, true>("modular_arithmetic<uint64_t, 1>", 64);
+		modular_arithmetic_128();
+		int_m<1073741789u>("int_m<2^30 - 35>");
+		int_m<4611686018427387847ull>("int_m<2^62 - 57>");
+		int_m<998244353u>("int_m<998244353>");
+		int_m<2147483647u>("int_m<2^31 - 1>");
+		int_m<2305843009213693951ull>("int_m<2^61 - 1>");
+		int_m<9223372036854775783ull>("int_m<2^63 - 25>");
+	}
+
+}
+
+namespace fenwick_tree_test {
+
+	using harness::u64;
+	using operation = std::array<u64, 3>;
+
+	std::vector<operation> operations(const std::string& label, u64 size, std::size_t n) {
+		harness::generator gen{label};
+		std::vector<operation> res;
+		for (std::size_t i{0}; i != n; ++i) {
+			u64 r{gen.below(8)};
+			u64 index{r == 0 ? 0 : r == 1 ? size - 1 : gen.below(size)};
+			res.push_back({gen.below(2), index, gen.bits(32)});
+		}
+		return res;
+	}
+
+	template<class Tree>
+	void prefix(const std::string& label, Tree tree, const std::vector<u64>& initial) {
+		std::vector<u64> naive(initial);
+		auto ops{operations(label, naive.size(), harness::count(1 << 17))};
+		harness::differential(label, ops,
+			[&](const operation& op) -> u64 {
+				if (op[0] == 0) {
+					tree.apply(op[1], op[2]);
+					return 0;
+				}
+				return tree[op[1]];
+			},
+			[&](const operation& op) -> u64 {
+				if (op[0] == 0) {
+					naive[op[1]] += op[2];
+					return 0;
+				}
+				u64 res{0};
+				for (u64 i{0}; i <= op[1]; ++i) {
+					res += naive[i];
+				}
+				return res;
+			});
+	}
+
+	void run() {
+		harness::generator gen{"fenwick_tree"};
+		std::vector<u64> initial(1000);
+		for (auto& x : initial) {
+			x = gen.bits(32);
+		}
+		std::vector<u64> zeros(initial.size());
+
+		prefix("fenwick_tree", concrete::fenwick_tree<u64>{initial.begin(), initial.end()}, initial);
+		prefix("fenwick_tree_atomic", concrete::fenwick_tree_atomic<u64>{initial.begin(), initial.end()}, initial);
+		prefix("fenwick_tree_sharded", concrete::fenwick_tree_sharded<u64>{initial.begin(), initial.end(), 4}, initial);
+		prefix("fenwick_tree_persistent", concrete::fenwick_tree_persistent<u64>{initial.begin(), initial.end()}, initial);
+		prefix("fenwick_tree_sparse", concrete::fenwick_tree_sparse<u64>{initial.size()}, zeros);
+
+		std::vector<u64> large(1 << 18);
+		for (auto& x : large) {
+			x = gen();
+		}
+		concrete::fenwick_tree<u64> built{large.begin(), large.end()};
+		std::vector<u64> indices(large.size());
+		std::vector<u64> prefixes(large.size());
+		for (std::size_t i{0}; i != large.size(); ++i) {
+			indices[i] = i;
+			prefixes[i] = (i == 0 ? 0 : prefixes[i - 1]) + large[i];
+		}
+		harness::differential("fenwick_tree (parallel build)", indices, [&](u64 i) { return built[i]; }, [&](u64 i) { return prefixes[i]; });
+		std::size_t odd{large.size() - 4321};
+		concrete::fenwick_tree<u64> builtOdd{large.begin(), large.begin() + odd};
+		concrete::fenwick_tree<u64, concrete::maximum<u64>> builtMax{large.begin(), large.begin() + odd};
+		concrete::fenwick_tree_diff<u64> builtDiff{large.begin(), large.begin() + odd};
+		std::vector<u64> maxima(odd);
+		for (std::size_t i{0}; i != odd; ++i) {
+			maxima[i] = std::max(i == 0 ? 0 : maxima[i - 1], large[i]);
+		}
+		std::vector<u64> oddIndices(indices.begin(), indices.begin() + odd);
+		harness::differential("fenwick_tree (parallel build, unaligned)", oddIndices,
+			[&](u64 i) { return builtOdd[i] ^ builtMax[i] * 3 ^ builtDiff[i] * 5; },
+			[&](u64 i) { return prefixes[i] ^ maxima[i] * 3 ^ large[i] * 5; });
+
+#if defined(__unix__) || defined(__APPLE__)
+		std::string path{(std::filesystem::temp_directory_path() / ("concrete_test_" + std::to_string(harness::seed) + ".fenwick")).string()};
+		prefix("fenwick_tree_mapped", concrete::fenwick_tree_mapped<u64>{path.c_str(), initial.begin(), initial.end()}, initial);
+		{
+			concrete::fenwick_tree_mapped<u64> mapped{path.c_str(), large.begin(), large.end()};
+			mapped.checkpoint();
+		}
+		concrete::fenwick_tree_mapped<u64> reopened{path.c_str()};
+		concrete::fenwick_tree_mapped<concrete::uint32_t> mismatched{path.c_str()};
+		concrete::fenwick_tree_mapped<double> retyped{path.c_str()};
+		concrete::fenwick_tree_mapped<u64, concrete::maximum<u64>> reassociated{path.c_str()};
+		harness::differential("fenwick_tree_mapped (reopened)", indices,
+			[&](u64 i) { return reopened && !mismatched && !retyped && !reassociated && reopened.size() == large.size() ? reopened[i] : ~u64{0}; },
+			[&](u64 i) { return prefixes[i]; });
+		{
+			concrete::fenwick_tree_mapped<u64> single{path.c_str(), 1};
+		}
+		concrete::detail::mapped::header forged{};
+		std::FILE* file{std::fopen(path.c_str(), "r+b")};
+		bool rewritten{file != nullptr && std::fread(&forged, sizeof(forged), 1, file) == 1};
+		forged.size = (u64{1} << 61) + 1;
+		rewritten = rewritten && std::fseek(file, 0, SEEK_SET) == 0 && std::fwrite(&forged, sizeof(forged), 1, file) == 1;
+		if (file != nullptr) {
+			std::fclose(file);
+		}
+		concrete::fenwick_tree_mapped<u64> oversized{path.c_str()};
+		harness::differential("fenwick_tree_mapped (oversized header)", std::vector<u64>{0},
+			[&](u64) { return rewritten && !oversized; },
+			[&](u64) { return true; });
+		std::filesystem::remove(path);
+#endif
+
+		std::pmr::monotonic_buffer_resource arena;
+		prefix("pmr::fenwick_tree", concrete::pmr::fenwick_tree<u64>{initial.begin(), initial.end(), &arena}, initial);
+
+		std::vector<u64> empty;
+		concrete::fenwick_tree_diff<u64> none{empty.begin(), empty.end()};
+		concrete::pmr::fenwick_tree_diff<u64> diff{initial.begin(), initial.end(), &arena};
+		std::vector<u64> naive(initial);
+		auto ops{operations("pmr::fenwick_tree_diff", initial.size(), harness::count(1 << 17))};
+		harness::differential("pmr::fenwick_tree_diff", ops,
+			[&](const operation& op) -> u64 {
+				if (op[0] == 0) {
+					diff.apply(op[1] / 2, op[1], op[2]);
+					return 0;
+				}
+				return diff[op[1]];
+			},
+			[&](const operation& op) -> u64 {
+				if (op[0] == 0) {
+					for (u64 i{op[1] / 2}; i != op[1]; ++i) {
+						naive[i] += op[2];
+					}
+					return 0;
+				}
+				return naive[op[1]];
+			});
+
+		std::vector<u64> keys(512);
+		for (auto& k : keys) {
+			k = gen();
+		}
+		concrete::fenwick_tree_compressed<u64> compressed{keys.begin(), keys.end()};
+		std::vector<std::array<u64, 2>> entries;
+		auto keyed{operations("fenwick_tree_compressed", keys.size(), harness::count(1 << 16))};
+		harness::differential("fenwick_tree_compressed", keyed,
+			[&](const operation& op) -> u64 {
+				if (op[0] == 0) {
+					compressed.apply(keys[op[1]] + (op[2] % 4 == 0), op[2]);
+					return 0;
+				}
+				return compressed[keys[op[1]] - op[2] % 2];
+			},
+			[&](const operation& op) -> u64 {
+				if (op[0] == 0) {
+					u64 key{keys[op[1]] + (op[2] % 4 == 0)};
+					if (std::find(keys.begin(), keys.end(), key) != keys.end()) {
+						entries.push_back({key, op[2]});
+					}
+					return 0;
+				}
+				u64 res{0};
+				for (const auto& e : entries) {
+					if (e[0] <= keys[op[1]] - op[2] % 2) {
+						res += e[1];
+					}
+				}
+				return res;
+			});
+	}
+
+}
+
+namespace fast_io_test {
+
+	using harness::u64;
+	using harness::u128;
+	using pair = std::array<u64, 2>;
+
+	std::vector<u64> values(const std::string& label) {
+		harness::generator gen{label};
+		std::vector<u64> res{0, 1, 9, 10, 99999999, 100000000, ~u64{0}, u64{1} << 63};
+		for (std::size_t i{0}, n{harness::count(1 << 18)}; i != n; ++i) {
+			res.push_back(gen.any());
+		}
+		return res;
+	}
+
+	void read() {
+		auto inputs{values("fast_io read")};
+		std::FILE* file{std::tmpfile()};
+		for (u64 x : inputs) {
+			std::fprintf(file, x % 3 == 0 ? "%" PRId64 "\n" : "%" PRId64 " ", (std::int64_t)x);
+		}
+		std::rewind(file);
+		concrete::input in{file};
+		harness::differential("fast_io read int64_t", inputs,
+			[&](u64) { return (u64)in.read<concrete::int64_t>(); },
+			[](u64 x) { return x; });
+		std::fclose(file);
+	}
+
+	void write() {
+		auto inputs{values("fast_io write")};
+		std::FILE* file{std::tmpfile()};
+		{
+			concrete::output out{file};
+			for (u64 x : inputs) {
+				out << x << (x % 3 == 0 ? '\n' : ' ');
+			}
+		}
+		std::rewind(file);
+		harness::differential("fast_io write uint64_t", inputs,
+			[&](u64) {
+				std::uint64_t x{};
+				return std::fscanf(file, "%" SCNu64, &x) == 1 ? (u64)x : ~(u64)x;
+			},
+			[](u64 x) { return x; });
+		std::fclose(file);
+	}
+
+	void round_trip() {
+		harness::generator gen{"fast_io uint128_t"};
+		std::vector<pair> inputs{{0, 0}, {0, ~u64{0}}, {1, 0}, {~u64{0}, ~u64{0}}};
+		for (std::size_t i{0}, n{harness::count(1 << 18)}; i != n; ++i) {
+			inputs.push_back({gen.any(), gen.any()});
+		}
+		std::FILE* file{std::tmpfile()};
+		{
+			concrete::output out{file};
+			for (const pair& x : inputs) {
+				out << ((u128)x[0] << 64 | x[1]) << ' ' << -(concrete::int128_t)x[1] << '\n';
+			}
+		}
+		std::rewind(file);
+		concrete::input in{file};
+		harness::differential("fast_io uint128_t round trip", inputs,
+			[&](const pair& x) {
+				u128 value{in.read<u128>()};
+				return value == ((u128)x[0] << 64 | x[1]) && in.read<concrete::int128_t>() == -(concrete::int128_t)x[1];
+			},
+			[](const pair&) { return true; });
+		std::fclose(file);
+	}
+
+	void modular() {
+		using mint = concrete::int_m<998244353u>;
+		harness::generator gen{"fast_io int_m"};
+		std::vector<pair> inputs;
+		for (std::size_t i{0}, n{harness::count(1 << 18)}; i != n; ++i) {
+			inputs.push_back({gen.any(), gen.below(2)});
+		}
+		std::FILE* file{std::tmpfile()};
+		for (const pair& x : inputs) {
+			std::fprintf(file, "%s%" PRIu64 "%019" PRIu64 " ", x[1] == 0 ? "" : "-", (std::uint64_t)x[0], (std::uint64_t)(x[0] % 10000000000000000000ull));
+		}
+		std::rewind(file);
+		concrete::input in{file};
+		harness::differential("fast_io int_m<998244353>", inputs,
+			[&](const pair&) { return (u64)(concrete::uint32_t)in.read<mint>(); },
+			[](const pair& x) {
+				u64 m{998244353}, r{(u64)(((u128)x[0] * 10000000000000000000ull + x[0] % 10000000000000000000ull) % m)};
+				return x[1] == 0 || r == 0 ? r : m - r;
+			});
+		std::fclose(file);
+	}
+
+#if defined(__unix__) || defined(__APPLE__)
+	void pipe() {
+		using mint = concrete::int_m<998244353u>;
+		harness::generator gen{"fast_io pipe"};
+		std::vector<u64> inputs;
+		std::string text;
+		for (std::size_t i{0}, n{harness::count(1 << 12)}; i != n; ++i) {
+			std::size_t size{1 + gen.below(200)};
+			inputs.push_back(0);
+			for (std::size_t j{0}; j != size; ++j) {
+				u64 digit{gen.below(10)};
+				text += (char)('0' + digit);
+				inputs.back() = (inputs.back() * 10 + digit) % 998244353;
+			}
+			text += gen.below(4) == 0 ? '\n' : ' ';
+		}
+		int fds[2];
+		if (::pipe(fds) != 0) {
+			std::cout << "fast_io pipe: pipe() failed\n";
+			++harness::failures;
+			return;
+		}
+		std::thread writer{[&] {
+			for (std::size_t i{0}; i != text.size();) {
+				::ssize_t n{::write(fds[1], text.data() + i, std::min<std::size_t>(text.size() - i, 4093))};
+				if (n <= 0) {
+					break;
+				}
+				i += (std::size_t)n;
+			}
+			::close(fds[1]);
+		}};
+		std::FILE* file{::fdopen(fds[0], "r")};
+		concrete::input in{file};
+		harness::differential("fast_io int_m<998244353> (pipe)", inputs,
+			[&](u64) { return (u64)(concrete::uint32_t)in.read<mint>(); },
+			[](u64 x) { return x; });
+		writer.join();
+		std::fclose(file);
+	}
+#endif
+
+	void run() {
+		read();
+		write();
+		round_trip();
+		modular();
+#if defined(__unix__) || defined(__APPLE__)
+		pipe();
+#endif
+	}
+
+}
+
+namespace random_test {
+
+	using harness::u64;
+	using operation = std::array<u64, 2>;
+
+	void philox() {
+		harness::generator gen{"philox4x32"};
+		std::vector<operation> inputs{{0, 0}, {~u64{0}, ~u64{0}}, {0x299F31D0A4093822, 0x85A308D3243F6A88}};
+		for (std::size_t i{0}, n{harness::count(1 << 12)}; i != n; ++i) {
+			inputs.push_back({gen(), gen.below(4) == 0 ? ~u64{0} - gen.bits(4) : gen()});
+		}
+		harness::differential("philox4x32 known answers", std::vector<u64>{0, 1, 2},
+			[](u64 i) {
+				constexpr u64 keys[]{0, ~u64{0}, 0x299F31D0A4093822}, counters[][2]{{0, 0}, {~u64{0}, ~u64{0}}, {0x85A308D3243F6A88, 0x0370734413198A2E}};
+				concrete::uint32_t out[4]{};
+				concrete::detail::random::philox_block(keys[i], counters[i][0], counters[i][1], out);
+				return (u64)out[0] << 32 | out[3];
+			},
+			[](u64 i) {
+				constexpr u64 expected[]{0x6627E8D59B00DBD8, 0x408F276D6D5451FD, 0xD16CFE0924126EA1};
+				return expected[i];
+			});
+		harness::differential("philox4x32 discard", inputs,
+			[](const operation& x) {
+				concrete::philox4x32 eng{x[0], x[1]};
+				eng();
+				eng.discard(x[0] % 1000);
+				return (u64)eng();
+			},
+			[](const operation& x) {
+				concrete::philox4x32 eng{x[0], x[1]};
+				for (u64 i{0}; i != x[0] % 1000 + 1; ++i) {
+					eng();
+				}
+				return (u64)eng();
+			});
+		harness::differential("philox4x32 fill", inputs,
+			[](const operation& x) {
+				concrete::philox4x32 eng{x[0], x[1]};
+				eng.discard(x[0] % 3);
+				std::vector<concrete::uint32_t> buffer(x[1] % 1000);
+				eng.fill(buffer.data(), buffer.size());
+				u64 res{0};
+				for (concrete::uint32_t y : buffer) {
+					res = res * 31 + y;
+				}
+				return res * 31 + eng();
+			},
+			[](const operation& x) {
+				concrete::philox4x32 eng{x[0], x[1]};
+				eng.discard(x[0] % 3);
+				u64 res{0};
+				for (u64 i{0}; i != x[1] % 1000; ++i) {
+					res = res * 31 + eng();
+				}
+				return res * 31 + eng();
+			});
+	}
+
+	void xoshiro() {
+		harness::generator gen{"xoshiro256pp"};
+		std::vector<u64> inputs;
+		for (std::size_t i{0}, n{harness::count(1 << 10)}; i != n; ++i) {
+			inputs.push_back(gen());
+		}
+		harness::differential("xoshiro256pp jump", inputs,
+			[](u64 seed) {
+				concrete::xoshiro256pp eng{seed};
+				eng.jump();
+				return eng();
+			},
+			[](u64 seed) {
+				constexpr u64 polynomial[]{0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C};
+				u64 s[4], t[4]{};
+				for (u64& x : s) {
+					x = concrete::detail::random::splitmix64(seed);
+				}
+				auto next{[&] {
+					u64 res{concrete::rotl(s[0] + s[3], 23) + s[0]}, shift{s[1] << 17};
+					s[2] ^= s[0];
+					s[3] ^= s[1];
+					s[1] ^= s[2];
+					s[0] ^= s[3];
+					s[2] ^= shift;
+					s[3] = concrete::rotl(s[3], 45);
+					return res;
+				}};
+				for (u64 word : polynomial) {
+					for (int b{0}; b != 64; ++b) {
+						if (word >> b & 1) {
+							for (int i{0}; i != 4; ++i) {
+								t[i] ^= s[i];
+							}
+						}
+						next();
+					}
+				}
+				std::copy(t, t + 4, s);
+				return next();
+			});
+	}
+
+	void uniform() {
+		harness::generator gen{"uniform_int"};
+		std::vector<u64> inputs{1, 2, 3, 6, 1ull << 32, (1ull << 32) + 1, ~u64{0}};
+		for (std::size_t i{0}, n{harness::count(1 << 16)}; i != n; ++i) {
+			inputs.push_back(gen.any() | 1);
+		}
+		concrete::xoshiro256pp x{harness::seed};
+		concrete::philox4x32 p{harness::seed};
+		harness::differential("uniform_int bounds", inputs,
+			[&](u64 bound) { return concrete::uniform_int(x, bound) < bound && concrete::uniform_int(p, bound) < bound; },
+			[](u64) { return true; });
+	}
+
+	void run() {
+		philox();
+		xoshiro();
+		uniform();
+	}
+
+}
+
+namespace rolling_hash_test {
+
+	using harness::u64;
+	using query = std::array<u64, 2>;
+
+	template<auto m>
+	void run(const std::string& label) {
+		using mint = concrete::int_m<m>;
+		using value_type = typename mint::value_type;
+		harness::generator gen{label};
+		std::string s(harness::count(1 << 16) + gen.below(64), 'a');
+		for (char& c : s) {
+			c = (char)gen.bits(8);
+		}
+		mint base{(value_type)(gen.below(1 << 20) + 256)};
+		concrete::rolling_hash<mint> hash{s, base};
+		std::vector<query> queries{{0, s.size()}, {0, 0}, {s.size(), s.size()}};
+		for (std::size_t i{0}, n{harness::count(1 << 12)}; i != n; ++i) {
+			u64 first{gen.below(s.size() + 1)};
+			queries.push_back({first, first + gen.below(std::min<u64>(s.size() - first, 256) + 1)});
+		}
+		harness::differential(label, queries,
+			[&](const query& q) { return (u64)(value_type)hash(q[0], q[1]); },
+			[&](const query& q) {
+				mint res{0};
+				for (u64 i{q[0]}; i != q[1]; ++i) {
+					res = res * base + mint{(value_type)(unsigned char)s[i]};
+				}
+				return (u64)(value_type)res;
+			});
+	}
+
+	void run() {
+		run<2305843009213693951ull>("rolling_hash<2^61 - 1>");
+		run<998244353u>("rolling_hash<998244353>");
+	}
+
+}
+
+namespace hash_map_test {
+
+	using harness::u64;
+	using operation = std::array<u64, 3>;
+
+	template<class Key>
+	Key key(u64 x, u64 range) {
+		Key res{(Key)(x - range / 2)};
+		if constexpr (sizeof(Key) > 8) {
+			res ^= (Key)((concrete::make_unsigned_t<Key>)res << (unsigned)(sizeof(Key) * 8 - 32));
+		}
+		return res;
+	}
+
+	template<class Key>
+	void run(const std::string& label, u64 range) {
+		harness::generator gen{label};
+		std::vector<operation> ops;
+		for (std::size_t i{0}, n{harness::count(1 << 18)}; i != n; ++i) {
+			u64 r{gen.below(1024)};
+			ops.push_back({r == 0 ? 4 : r == 1 ? 5 : r < 8 ? 3 : r % 3, gen.below(range), gen.bits(32)});
+		}
+		concrete::flat_hash_map<Key, u64> map;
+		std::map<Key, u64> naive;
+		harness::differential(label, ops,
+			[&](const operation& op) -> u64 {
+				Key k{key<Key>(op[1], range)};
+				switch (op[0]) {
+				case 0:
+					return map[k] += op[2];
+				case 1:
+					if (auto it{map.find(k)}; it != map.end()) {
+						return it->second;
+					}
+					return ~u64{0};
+				case 2:
+					return map.erase(k);
+				case 3:
+					return map.size();
+				case 5: {
+					concrete::flat_hash_map<Key, u64> moved{std::move(map)};
+					u64 res{map.size() + (map.find(k) != map.end())};
+					map[k] = op[2];
+					map = std::move(moved);
+					return res + moved.size() + map.size();
+				}
+				default:
+					u64 res{0};
+					for (const auto& [x, value] : map) {
+						res += value * (u64)(x & (Key)0xFFFF);
+					}
+					return res;
+				}
+			},
+			[&](const operation& op) -> u64 {
+				Key k{key<Key>(op[1], range)};
+				switch (op[0]) {
+				case 0:
+					return naive[k] += op[2];
+				case 1:
+					if (auto it{naive.find(k)}; it != naive.end()) {
+						return it->second;
+					}
+					return ~u64{0};
+				case 2:
+					return naive.erase(k);
+				case 3:
+				case 5:
+					return naive.size();
+				default:
+					u64 res{0};
+					for (const auto& [x, value] : naive) {
+						res += value * (u64)(x & (Key)0xFFFF);
+					}
+					return res;
+				}
+			});
+	}
+
+	void run() {
+		run<concrete::uint64_t>("flat_hash_map<uint64_t> dense", 1 << 10);
+		run<concrete::uint64_t>("flat_hash_map<uint64_t> sparse", ~u64{0});
+		run<concrete::int32_t>("flat_hash_map<int32_t>", 1 << 16);
+		run<concrete::uint8_t>("flat_hash_map<uint8_t>", 1 << 8);
+		run<concrete::int128_t>("flat_hash_map<int128_t>", 1 << 12);
+		run<concrete::uint256_t>("flat_hash_map<uint256_t>", 1 << 12);
+	}
+
+}
+
+namespace standard_test {
+
+	using harness::u64;
+	using pair = std::array<u64, 2>;
+
+	static_assert(concrete::popcount(0xF0F0u) == 8 && concrete::popcount(~concrete::uint128_t{0}) == 128 && concrete::countl_zero((concrete::uint16_t)1) == 15 && concrete::countr_zero(u64{1} << 40) == 40);
+	static_assert(concrete::rotl((concrete::uint8_t)0x81, 1) == 0x03 && concrete::rotr(0x1u, -1) == 0x2u && concrete::byteswap(0x01020304u) == 0x04030201u);
+	static_assert(concrete::bit_width(u64{0}) == 0 && concrete::bit_ceil(5u) == 8u && concrete::bit_floor(5u) == 4u);
+
+	template<class T>
+	u64 bit(u64 x, int i) {
+		return i < (int)sizeof(T) * 8 ? x >> i & 1 : 0;
+	}
+
+	template<class T>
+	void bits(const std::string& label) {
+		constexpr int width{sizeof(T) * 8};
+		harness::generator gen{label};
+		std::vector<u64> inputs{0, ~u64{0}};
+		for (int i{0}; i != width; ++i) {
+			inputs.insert(inputs.end(), {u64{1} << i, (u64{1} << i) - 1, ~(u64{1} << i)});
+		}
+		for (std::size_t i{0}, n{harness::count(1 << 18)}; i != n; ++i) {
+			inputs.push_back(gen.any());
+		}
+		for (u64& x : inputs) {
+			x = (T)x;
+		}
+		harness::differential(label + " popcount", inputs, [](u64 x) { return (u64)concrete::popcount((T)x); },
+			[](u64 x) { u64 res{0}; for (int i{0}; i != width; ++i) { res += bit<T>(x, i); } return res; });
+		harness::differential(label + " countl_zero", inputs, [](u64 x) { return (u64)concrete::countl_zero((T)x); },
+			[](u64 x) { u64 res{0}; for (int i{width - 1}; i >= 0 && bit<T>(x, i) == 0; --i) { ++res; } return res; });
+		harness::differential(label + " countr_zero", inputs, [](u64 x) { return (u64)concrete::countr_zero((T)x); },
+			[](u64 x) { u64 res{0}; for (int i{0}; i != width && bit<T>(x, i) == 0; ++i) { ++res; } return res; });
+		harness::differential(label + " bit_floor", inputs, [](u64 x) { return (u64)concrete::bit_floor((T)x); },
+			[](u64 x) { u64 res{0}; for (int i{0}; i != width; ++i) { res = bit<T>(x, i) ? u64{1} << i : res; } return res; });
+		harness::differential(label + " byteswap", inputs, [](u64 x) { return (u64)concrete::byteswap((T)x); },
+			[](u64 x) { u64 res{0}; for (int i{0}; i != width / 8; ++i) { res |= (x >> (i * 8) & 0xff) << (width - 8 - i * 8); } return res; });
+
+		std::vector<pair> rotations;
+		for (u64 x : inputs) {
+			rotations.push_back({x, gen.below(4 * width + 1)});
+		}
+		harness::differential(label + " rotl/rotr", rotations,
+			[](const pair& x) { int s{(int)x[1] - 2 * width}; return (u64)concrete::rotl((T)x[0], s) << 32 ^ (u64)concrete::rotr((T)x[0], s); },
+			[](const pair& x) {
+				int r{(int)(x[1] % width)};
+				u64 left{0}, right{0};
+				for (int i{0}; i != width; ++i) {
+					left |= bit<T>(x[0], i) << (i + r) % width;
+					right |= bit<T>(x[0], i) << (i + 2 * width - r) % width;
+				}
+				return left << 32 ^ right;
+			});
+	}
+
+	void wide_popcount() {
+		harness::generator gen{"uint128_t popcount"};
+		std::vector<pair> inputs{{0, 0}, {~u64{0}, ~u64{0}}, {0, 1}, {1, 0}};
+		for (std::size_t i{0}, n{harness::count(1 << 16)}; i != n; ++i) {
+			inputs.push_back({gen.any(), gen.any()});
+		}
+		harness::differential("uint128_t popcount", inputs,
+			[](const pair& x) { return (u64)concrete::popcount((concrete::uint128_t)x[0] << 64 | x[1]) << 8 | (u64)concrete::popcount((concrete::int128_t)((concrete::uint128_t)x[0] << 64 | x[1])); },
+			[](const pair& x) {
+				u64 res{0};
+				for (int i{0}; i != 64; ++i) {
+					res += (x[0] >> i & 1) + (x[1] >> i & 1);
+				}
+				return res << 8 | res;
+			});
+	}
+
+	template<int level>
+	u64 level_of() {
+		return level;
+	}
+
+	u64 dispatched(u64 mask, bool reversed) {
+		using function_type = u64(*)();
+		using concrete::isa;
+		auto entry{[&](isa level, function_type function) {
+			return mask >> (int)level & 1 ? std::pair{level, function} : std::pair{isa::generic, &level_of<0>};
+		}};
+		auto generic{entry(isa::generic, &level_of<0>)}, sse42{entry(isa::sse42, &level_of<1>)};
+		auto avx2{entry(isa::avx2, &level_of<2>)}, avx512{entry(isa::avx512, &level_of<3>)};
+		concrete::dispatch<u64()> res{reversed ? concrete::dispatch<u64()>{avx512, avx2, sse42, generic} : concrete::dispatch<u64()>{generic, sse42, avx2, avx512}};
+		return res() * 4 + (u64)res.selected();
+	}
+
+	void dispatch() {
+		std::vector<u64> masks;
+		for (u64 mask{1}; mask < 16; mask += 2) {
+			masks.push_back(mask);
+		}
+		auto expected{[](u64 mask) {
+			u64 res{0};
+			for (u64 level{0}; level <= (u64)concrete::active_isa(); ++level) {
+				res = mask >> level & 1 ? level : res;
+			}
+			return res * 5;
+		}};
+		harness::differential("dispatch selection", masks, [](u64 mask) { return dispatched(mask, false); }, expected);
+		harness::differential("dispatch selection (reversed)", masks, [](u64 mask) { return dispatched(mask, true); }, expected);
+		harness::differential("active_isa <= detected_isa", masks, [](u64) { return concrete::active_isa() <= concrete::detected_isa(); }, [](u64) { return true; });
+	}
+
+	template<class Kernel>
+	void popcount(const std::string& label, concrete::isa level, Kernel kernel) {
+		if (concrete::detected_isa() < level) {
+			return;
+		}
+		harness::generator gen{label};
+		std::vector<u64> words(1 << 14);
+		for (u64& w : words) {
+			w = gen.below(4) == 0 ? ~u64{0} : gen();
+		}
+		std::vector<pair> inputs;
+		for (std::size_t i{0}, n{harness::count(1 << 13)}; i != n; ++i) {
+			u64 first{gen.below(words.size())};
+			inputs.push_back({first, gen.below(words.size() - first + 1)});
+		}
+		harness::differential(label, inputs, [&](const pair& x) { return kernel(words.data() + x[0], (std::size_t)x[1]); },
+			[&](const pair& x) {
+				u64 res{0};
+				for (u64 i{x[0]}; i != x[0] + x[1]; ++i) {
+					for (u64 w{words[i]}; w != 0; w &= w - 1) {
+						++res;
+					}
+				}
+				return res;
+			});
+	}
+
+	void run() {
+		bits<concrete::uint8_t>("uint8_t");
+		bits<concrete::uint16_t>("uint16_t");
+		bits<concrete::uint32_t>("uint32_t");
+		bits<concrete::uint64_t>("uint64_t");
+		wide_popcount();
+		dispatch();
+		popcount("popcount_generic", concrete::isa::generic, concrete::detail::bits::popcount_generic);
+#if !defined(_MSC_VER) && (defined(__x86_64__) || defined(__i386__))
+		popcount("popcount_sse42", concrete::isa::sse42, concrete::detail::bits::popcount_sse42);
+		popcount("popcount_avx2", concrete::isa::avx2, concrete::detail::bits::popcount_avx2);
+		popcount("popcount_avx512", concrete::isa::avx512, concrete::detail::bits::popcount_avx512);
+#endif
+		popcount("popcount (dispatched)", concrete::isa::generic, [](const u64* data, std::size_t size) { return concrete::popcount(data, size); });
+	}
+
+}
+
+namespace bit_vector_test {
+
+	using harness::u64;
+
+	void run(const std::string& label, std::size_t size, u64 density, bool fromWords) {
+		harness::generator gen{label};
+		std::vector<u64> words((size + 63) / 64 + 1);
+		std::vector<bool> bits(size);
+		for (std::size_t i{0}; i != words.size() * 64; ++i) {
+			bool b{gen.below(64) < density};
+			words[i / 64] |= (u64)b << i % 64;
+			if (i < size) {
+				bits[i] = b;
+			}
+		}
+		concrete::bit_vector bv{fromWords ? concrete::bit_vector{words, size} : concrete::bit_vector{bits.begin(), bits.end()}};
+
+		std::vector<u64> ranks(size + 1), positions[2];
+		for (std::size_t i{0}; i != size; ++i) {
+			ranks[i + 1] = ranks[i] + bits[i];
+			positions[bits[i]].push_back(i);
+		}
+		std::vector<u64> indices{0, size};
+		for (std::size_t i{0}, n{harness::count(1 << 16)}; i != n; ++i) {
+			indices.push_back(gen.below(size + 1));
+		}
+		harness::differential(label + " rank1/rank0", indices, [&](u64 i) { return bv.rank1(i) << 32 ^ bv.rank0(i); },
+			[&](u64 i) { return ranks[i] << 32 ^ (i - ranks[i]); });
+		harness::differential(label + " access", indices, [&](u64 i) { return i == size ? bv.count() : (u64)bv[i]; },
+			[&](u64 i) { return i == size ? ranks[size] : (u64)bits[i]; });
+
+		std::vector<u64> ks{0, positions[0].size(), positions[1].size(), positions[1].size() + 1};
+		for (std::size_t i{0}, n{harness::count(1 << 16)}; i != n; ++i) {
+			ks.push_back(gen.below(size + 2));
+		}
+		harness::differential(label + " select1/select0", ks, [&](u64 k) { return bv.select1(k) << 32 ^ bv.select0(k); },
+			[&](u64 k) {
+				u64 one{k < positions[1].size() ? positions[1][k] : size}, zero{k < positions[0].size() ? positions[0][k] : size};
+				return one << 32 ^ zero;
+			});
+	}
+
+	void run() {
+		run("bit_vector", (1 << 20) + 37, 32, false);
+		run("bit_vector (sparse)", (1 << 20) + 1, 1, false);
+		run("bit_vector (dense)", 1 << 20, 63, true);
+		run("bit_vector (words)", 100000, 20, true);
+		run("bit_vector (all ones)", 6000, 64, false);
+		run("bit_vector (all zeros)", 6000, 0, true);
+		run("bit_vector (small)", 37, 32, false);
+	}
+
+}
+
+namespace numeric_test {
+
+	using harness::u64;
+	using harness::affine;
+	using pair = std::array<u64, 2>;
+
+	template<class T, class Op, class Generate>
+	void run(const std::string& label, T init, Generate generate) {
+		harness::generator gen{label};
+		std::vector<T> values(1 << 18);
+		for (T& x : values) {
+			x = generate(gen);
+		}
+		std::vector<pair> ranges{{0, 0}, {0, values.size()}, {1, values.size() - 1}};
+		for (std::size_t i{0}, n{harness::count(1 << 10)}; i != n; ++i) {
+			u64 first{gen.below(values.size())};
+			ranges.push_back({first, gen.below(4) == 0 ? values.size() - first : gen.below((values.size() - first) / 64 + 1)});
+		}
+		auto naive{[&](const pair& x) {
+			T res{init};
+			for (u64 i{x[0]}; i != x[0] + x[1]; ++i) {
+				res = Op{}(res, values[i]);
+			}
+			return harness::fold(res);
+		}};
+		harness::differential(label + " reduce", ranges,
+			[&](const pair& x) { return harness::fold(concrete::reduce(values.begin() + x[0], values.begin() + x[0] + x[1], init, Op{})); }, naive);
+
+		std::vector<T> inclusive(values.size()), exclusive(values.size()), seeded(values.size());
+		concrete::inclusive_scan(values.begin(), values.end(), inclusive.begin(), Op{});
+		concrete::exclusive_scan(values.begin(), values.end(), exclusive.begin(), init, Op{});
+		concrete::inclusive_scan(values.begin(), values.end(), seeded.begin(), Op{}, init);
+		std::vector<u64> indices;
+		for (std::size_t i{0}; i < values.size(); i += 1 + gen.below(8)) {
+			indices.push_back(i);
+		}
+		std::vector<T> prefix(values.size() + 1, init);
+		for (std::size_t i{0}; i != values.size(); ++i) {
+			prefix[i + 1] = Op{}(prefix[i], values[i]);
+		}
+		T first{values[0]};
+		std::vector<T> unseeded(values.size(), first);
+		for (std::size_t i{1}; i != values.size(); ++i) {
+			unseeded[i] = Op{}(unseeded[i - 1], values[i]);
+		}
+		harness::differential(label + " scan", indices,
+			[&](u64 i) { return harness::fold(inclusive[i]) ^ harness::fold(exclusive[i]) << 1 ^ harness::fold(seeded[i]) << 2; },
+			[&](u64 i) { return harness::fold(unseeded[i]) ^ harness::fold(prefix[i]) << 1 ^ harness::fold(prefix[i + 1]) << 2; });
+	}
+
+	void run() {
+		run<u64, concrete::add<u64>>("numeric add<uint64_t>", 12345, [](harness::generator& gen) { return gen(); });
+		run<u64, concrete::maximum<u64>>("numeric maximum<uint64_t>", 0, [](harness::generator& gen) { return gen.any(); });
+		run<u64, concrete::subtract<u64>>("numeric subtract<uint64_t>", 1, [](harness::generator& gen) { return gen(); });
+		run<affine, harness::compose>("numeric affine composition", affine{3, 5}, [](harness::generator& gen) { return affine{gen(), gen()}; });
+		run<u64, harness::midpoint>("numeric midpoint<uint64_t>", 0, [](harness::generator& gen) { return gen(); });
+	}
+
+}
+
+namespace sparse_table_test {
+
+	using harness::u64;
+	using harness::affine;
+	using pair = std::array<u64, 2>;
+
+	template<class Table, class T, class Op, class Generate>
+	void run(const std::string& label, std::size_t size, Generate generate) {
+		harness::generator gen{label};
+		std::vector<T> values(size);
+		for (T& x : values) {
+			x = generate(gen);
+		}
+		Table table{values.begin(), values.end()};
+		std::vector<pair> ranges{{0, size}, {size - 1, size}, {0, 1}};
+		for (std::size_t i{0}, n{harness::count(1 << 14)}; i != n; ++i) {
+			u64 first{gen.below(size)};
+			ranges.push_back({first, first + 1 + (gen.below(2) == 0 ? gen.below(size - first) : gen.below(std::min<u64>(size - first, 80)))});
+		}
+		harness::differential(label, ranges, [&](const pair& x) { return harness::fold(table.query(x[0], x[1])); },
+			[&](const pair& x) {
+				T res{values[x[0]]};
+				for (u64 i{x[0] + 1}; i != x[1]; ++i) {
+					res = Op{}(res, values[i]);
+				}
+				return harness::fold(res);
+			});
+	}
+
+	void run() {
+		using concrete::minimum;
+		using concrete::maximum;
+		using concrete::add;
+		auto any{[](harness::generator& gen) { return gen.any(); }};
+		auto transform{[](harness::generator& gen) { return affine{gen(), gen()}; }};
+		for (std::size_t size : {1, 2, 3, 1000, 4097}) {
+			std::string suffix{" (" + std::to_string(size) + ")"};
+			run<concrete::sparse_table<u64, minimum<u64>>, u64, minimum<u64>>("sparse_table<minimum>" + suffix, size, any);
+			run<concrete::sparse_table<u64, maximum<u64>>, u64, maximum<u64>>("sparse_table<maximum>" + suffix, size, any);
+			run<concrete::disjoint_sparse_table<u64, add<u64>>, u64, add<u64>>("disjoint_sparse_table<add>" + suffix, size, any);
+			run<concrete::disjoint_sparse_table<affine, harness::compose>, affine, harness::compose>("disjoint_sparse_table<affine>" + suffix, size, transform);
+			run<concrete::block_sparse_table<u64, minimum<u64>>, u64, minimum<u64>>("block_sparse_table<minimum>" + suffix, size, any);
+			run<concrete::block_sparse_table<u64, add<u64>>, u64, add<u64>>("block_sparse_table<add>" + suffix, size, any);
+			run<concrete::block_sparse_table<affine, harness::compose>, affine, harness::compose>("block_sparse_table<affine>" + suffix, size, transform);
+		}
+	}
+
+}
+
+namespace segment_tree_test {
+
+	using harness::u64;
+	using harness::affine;
+	using operation = std::array<u64, 4>;
+
+	std::vector<operation> operations(const std::string& label, u64 size, std::size_t n) {
+		harness::generator gen{label};
+		std::vector<operation> res;
+		for (std::size_t i{0}; i != n; ++i) {
+			u64 first{gen.below(size + 1)}, last{gen.below(size + 1)};
+			if (first > last) {
+				std::swap(first, last);
+			}
+			res.push_back({gen.below(6), first, last, gen.bits(1 + (int)gen.below(24))});
+		}
+		return res;
+	}
+
+	template<class T, class Op, class Pred, class Generate>
+	void run(const std::string& label, std::size_t size, Generate generate, Pred pred) {
+		harness::generator gen{label};
+		std::vector<T> naive(size);
+		for (T& x : naive) {
+			x = generate(gen);
+		}
+		concrete::segment_tree<T, Op> tree{naive.begin(), naive.end()};
+		auto ops{operations(label, size, harness::count(1 << 15))};
+		auto value{[&](const operation& op) { harness::generator local{std::to_string(op[3])}; return generate(local); }};
+		auto fold{[&](u64 first, u64 last) {
+			T res{concrete::algebraic_traits<Op>::identity};
+			for (u64 i{first}; i != last; ++i) {
+				res = Op{}(res, naive[i]);
+			}
+			return res;
+		}};
+		harness::differential(label, ops,
+			[&](const operation& op) -> u64 {
+				u64 index{op[1] == size ? 0 : op[1]};
+				switch (op[0]) {
+				case 0:
+					tree.set(index, value(op));
+					return 0;
+				case 1:
+					tree.apply(index, value(op));
+					return harness::fold(tree[index]);
+				case 2:
+					return harness::fold(tree.query(op[1], op[2]));
+				case 3:
+					return harness::fold(tree.query());
+				case 4:
+					return tree.max_right(op[1], [&](const T& x) { return pred(x, op[3]); });
+				default:
+					return tree.min_left(op[2], [&](const T& x) { return pred(x, op[3]); });
+				}
+			},
+			[&](const operation& op) -> u64 {
+				u64 index{op[1] == size ? 0 : op[1]};
+				switch (op[0]) {
+				case 0:
+					naive[index] = value(op);
+					return 0;
+				case 1:
+					naive[index] = Op{}(naive[index], value(op));
+					return harness::fold(naive[index]);
+				case 2:
+					return harness::fold(fold(op[1], op[2]));
+				case 3:
+					return harness::fold(fold(0, size));
+				case 4: {
+					u64 last{op[1]};
+					while (last != size && pred(fold(op[1], last + 1), op[3])) {
+						++last;
+					}
+					return last;
+				}
+				default: {
+					u64 first{op[2]};
+					while (first != 0 && pred(fold(first - 1, op[2]), op[3])) {
+						--first;
+					}
+					return first;
+				}
+				}
+			});
+	}
+
+	template<class Op, class Action>
+	void lazy(const std::string& label, std::size_t size) {
+		harness::generator gen{label};
+		std::vector<u64> naive(size);
+		for (u64& x : naive) {
+			x = gen.bits(24);
+		}
+		concrete::lazy_segment_tree<u64, Op, Action> tree{naive.begin(), naive.end()};
+		auto ops{operations(label, size, harness::count(1 << 15))};
+		auto fold{[&](u64 first, u64 last) {
+			u64 res{concrete::algebraic_traits<Op>::identity};
+			for (u64 i{first}; i != last; ++i) {
+				res = Op{}(res, naive[i]);
+			}
+			return res;
+		}};
+		auto apply{[&](u64 f, u64 x) { return (u64)Action::apply(typename Action::operator_type{f}, x, 1); }};
+		auto pred{[](u64 x, u64 bound) {
+			if constexpr (std::is_same_v<Op, concrete::add<u64>>) {
+				return x <= bound * 64;
+			}
+			else if constexpr (std::is_same_v<Op, concrete::maximum<u64>>) {
+				return x <= bound;
+			}
+			else {
+				return x >= bound;
+			}
+		}};
+		harness::differential(label, ops,
+			[&](const operation& op) -> u64 {
+				u64 index{op[1] == size ? 0 : op[1]};
+				switch (op[0]) {
+				case 0:
+					tree.set(index, op[3]);
+					return 0;
+				case 1:
+					tree.apply(index, typename Action::operator_type{op[3]});
+					return tree[index];
+				case 2:
+					tree.apply(op[1], op[2], typename Action::operator_type{op[3]});
+					return tree.query();
+				case 3:
+					return tree.query(op[1], op[2]);
+				case 4:
+					return tree.max_right(op[1], [&](u64 x) { return pred(x, op[3]); });
+				default:
+					return tree.min_left(op[2], [&](u64 x) { return pred(x, op[3]); });
+				}
+			},
+			[&](const operation& op) -> u64 {
+				u64 index{op[1] == size ? 0 : op[1]};
+				switch (op[0]) {
+				case 0:
+					naive[index] = op[3];
+					return 0;
+				case 1:
+					naive[index] = apply(op[3], naive[index]);
+					return naive[index];
+				case 2:
+					for (u64 i{op[1]}; i != op[2]; ++i) {
+						naive[i] = apply(op[3], naive[i]);
+					}
+					return fold(0, size);
+				case 3:
+					return fold(op[1], op[2]);
+				case 4: {
+					u64 last{op[1]};
+					while (last != size && pred(fold(op[1], last + 1), op[3])) {
+						++last;
+					}
+					return last;
+				}
+				default: {
+					u64 first{op[2]};
+					while (first != 0 && pred(fold(first - 1, op[2]), op[3])) {
+						--first;
+					}
+					return first;
+				}
+				}
+			});
+	}
+
+	void run() {
+		using concrete::add;
+		using concrete::maximum;
+		using concrete::minimum;
+		auto bits{[](harness::generator& gen) { return gen.bits(24); }};
+		auto transform{[](harness::generator& gen) { return affine{gen(), gen()}; }};
+		for (std::size_t size : {1, 300, 512}) {
+			std::string suffix{" (" + std::to_string(size) + ")"};
+			run<u64, add<u64>>("segment_tree<add>" + suffix, size, bits, [](u64 x, u64 bound) { return x <= bound * 64; });
+			run<u64, maximum<u64>>("segment_tree<maximum>" + suffix, size, bits, [](u64 x, u64 bound) { return x <= bound; });
+			run<affine, harness::compose>("segment_tree<affine>" + suffix, size, transform, [](const affine& x, u64 bound) { return concrete::countr_zero(x.a) <= (int)(bound % 16); });
+			lazy<add<u64>, concrete::range_add<u64>>("lazy_segment_tree<add, add>" + suffix, size);
+			lazy<maximum<u64>, concrete::range_add<u64, maximum<u64>>>("lazy_segment_tree<maximum, add>" + suffix, size);
+			lazy<minimum<u64>, concrete::range_assign<u64, minimum<u64>>>("lazy_segment_tree<minimum, assign>" + suffix, size);
+			lazy<add<u64>, concrete::range_assign<u64>>("lazy_segment_tree<add, assign>" + suffix, size);
+		}
+	}
+
+}
+
+namespace matrix_test {
+
+	using harness::u64;
+	using shape = std::array<u64, 4>;
+
+	template<class T>
+	T random_value(std::mt19937_64& eng) {
+		if constexpr (concrete::is_int_m_v<T>) {
+			u64 r{eng() % 8};
+			return T{(typename T::value_type)(r == 0 ? 0 : r == 1 ? (u64)T{}.modular_arithmetic().modulo() - 1 : eng())};
+		}
+		else {
+			return (T)eng();
+		}
+	}
+
+	template<class T>
+	u64 value(T x) {
+		if constexpr (concrete::is_int_m_v<T>) {
+			return harness::fold(x);
+		}
+		else {
+			return (u64)x;
+		}
+	}
+
+	template<class T>
+	std::vector<std::vector<T>> naive_multiply(const std::vector<std::vector<T>>& x, const std::vector<std::vector<T>>& y) {
+		std::vector<std::vector<T>> res(x.size(), std::vector<T>(y[0].size()));
+		for (std::size_t i{0}; i != x.size(); ++i) {
+			for (std::size_t j{0}; j != y[0].size(); ++j) {
+				for (std::size_t k{0}; k != y.size(); ++k) {
+					res[i][j] += x[i][k] * y[k][j];
+				}
+			}
+		}
+		return res;
+	}
+
+	template<class T, std::size_t n, std::size_t m, std::size_t l>
+	void static_multiply(const std::string& label) {
+		std::vector<u64> seeds(harness::count(1 << 12));
+		for (std::size_t i{0}; i != seeds.size(); ++i) {
+			seeds[i] = harness::seed + i;
+		}
+		auto load{[](u64 seed) {
+			std::mt19937_64 eng{seed};
+			std::vector<std::vector<T>> x(n, std::vector<T>(m)), y(m, std::vector<T>(l));
+			for (auto& row : x) {
+				for (T& v : row) {
+					v = random_value<T>(eng);
+				}
+			}
+			for (auto& row : y) {
+				for (T& v : row) {
+					v = random_value<T>(eng);
+				}
+			}
+			return std::pair{x, y};
+		}};
+		harness::differential(label, seeds,
+			[&](u64 seed) {
+				auto [x, y]{load(seed)};
+				concrete::static_matrix<T, n, m> a;
+				concrete::static_matrix<T, m, l> b;
+				for (std::size_t i{0}; i != n; ++i) {
+					for (std::size_t j{0}; j != m; ++j) {
+						a[i][j] = x[i][j];
+					}
+				}
+				for (std::size_t i{0}; i != m; ++i) {
+					for (std::size_t j{0}; j != l; ++j) {
+						b[i][j] = y[i][j];
+					}
+				}
+				auto c{a * b};
+				u64 res{0};
+				for (std::size_t i{0}; i != n; ++i) {
+					for (std::size_t j{0}; j != l; ++j) {
+						res = res * 0x100000001b3ull ^ value(c[i][j]);
+					}
+				}
+				return res;
+			},
+			[&](u64 seed) {
+				auto [x, y]{load(seed)};
+				auto c{naive_multiply(x, y)};
+				u64 res{0};
+				for (const auto& row : c) {
+					for (const T& v : row) {
+						res = res * 0x100000001b3ull ^ value(v);
+					}
+				}
+				return res;
+			});
+	}
+
+	template<class T>
+	concrete::matrix<T> random_matrix(std::mt19937_64& eng, std::size_t rows, std::size_t cols) {
+		concrete::matrix<T> res(rows, cols);
+		for (std::size_t i{0}; i != rows; ++i) {
+			for (std::size_t j{0}; j != cols; ++j) {
+				res[i][j] = random_value<T>(eng);
+			}
+		}
+		return res;
+	}
+
+	template<class T>
+	u64 fold(const concrete::matrix<T>& x) {
+		u64 res{x.row_count() << 32 | x.col_count()};
+		for (std::size_t i{0}; i != x.row_count() * x.col_count(); ++i) {
+			res = res * 0x100000001b3ull ^ value(x.data()[i]);
+		}
+		return res;
+	}
+
+	template<class T>
+	concrete::matrix<T> naive_multiply(const concrete::matrix<T>& x, const concrete::matrix<T>& y) {
+		concrete::matrix<T> res(x.row_count(), y.col_count());
+		for (std::size_t i{0}; i != x.row_count(); ++i) {
+			for (std::size_t j{0}; j != y.col_count(); ++j) {
+				for (std::size_t k{0}; k != x.col_count(); ++k) {
+					res[i][j] += x[i][k] * y[k][j];
+				}
+			}
+		}
+		return res;
+	}
+
+	template<class T>
+	void multiply(const std::string& label) {
+		harness::generator gen{label};
+		std::vector<shape> shapes{{1, 1, 1, 1}, {4, 8, 8, 1}, {7, 300, 9, 1}, {64, 64, 64, 2}, {130, 257, 70, 3}};
+		for (std::size_t i{0}, n{harness::count(48)}; i != n; ++i) {
+			shapes.push_back({1 + gen.below(120), 1 + gen.below(300), 1 + gen.below(120), 1 + gen.below(3)});
+		}
+		auto load{[](const shape& s) {
+			std::mt19937_64 eng{harness::seed ^ s[0] << 40 ^ s[1] << 20 ^ s[2]};
+			concrete::matrix<T> x{random_matrix<T>(eng, s[0], s[1])};
+			return std::pair{x, random_matrix<T>(eng, s[1], s[2])};
+		}};
+		harness::differential(label, shapes,
+			[&](const shape& s) { auto [x, y]{load(s)}; return fold(concrete::matrix_multiply(x, y, s[3])); },
+			[&](const shape& s) { auto [x, y]{load(s)}; return fold(naive_multiply(x, y)); });
+	}
+
+	template<class T>
+	std::pair<T, std::size_t> naive_eliminate(concrete::matrix<T> x) {
+		T det{1};
+		std::size_t rank{0};
+		for (std::size_t c{0}; c != x.col_count() && rank != x.row_count(); ++c) {
+			std::size_t p{rank};
+			while (p != x.row_count() && x[p][c] == T{0}) {
+				++p;
+			}
+			if (p == x.row_count()) {
+				det = T{0};
+				continue;
+			}
+			if (p != rank) {
+				for (std::size_t j{0}; j != x.col_count(); ++j) {
+					std::swap(x[p][j], x[rank][j]);
+				}
+				det = -det;
+			}
+			det *= x[rank][c];
+			for (std::size_t i{rank + 1}; i != x.row_count(); ++i) {
+				T f{x[i][c] / x[rank][c]};
+				for (std::size_t j{c}; j != x.col_count(); ++j) {
+					x[i][j] -= f * x[rank][j];
+				}
+			}
+			++rank;
+		}
+		return {rank == x.row_count() && rank == x.col_count() ? det : T{0}, rank};
+	}
+
+	template<class T>
+	void elimination(const std::string& label) {
+		harness::generator gen{label};
+		std::vector<shape> shapes{{1, 1, 1, 0}, {2, 2, 1, 0}, {65, 65, 65, 0}, {130, 130, 129, 0}, {70, 150, 70, 1}, {150, 70, 70, 1}};
+		for (std::size_t i{0}, n{harness::count(40)}; i != n; ++i) {
+			u64 rows{1 + gen.below(140)}, cols{gen.below(4) == 0 ? 1 + gen.below(140) : rows};
+			shapes.push_back({rows, cols, gen.below(2) == 0 ? std::min(rows, cols) : 1 + gen.below(std::min(rows, cols)), gen.below(2)});
+		}
+		auto load{[](const shape& s) {
+			std::mt19937_64 eng{harness::seed ^ s[0] << 40 ^ s[1] << 20 ^ s[2] << 1 ^ s[3]};
+			concrete::matrix<T> x{random_matrix<T>(eng, s[0], s[2])}, y{random_matrix<T>(eng, s[2], s[1])};
+			return naive_multiply(x, y);
+		}};
+		harness::differential(label + " determinant", shapes,
+			[&](const shape& s) { auto x{load(s)}; return s[0] == s[1] ? value(concrete::determinant(x)) : 0; },
+			[&](const shape& s) { auto x{load(s)}; return s[0] == s[1] ? value(naive_eliminate(x).first) : 0; });
+		harness::differential(label + " rank", shapes,
+			[&](const shape& s) { return (u64)concrete::rank(load(s)); },
+			[&](const shape& s) { return (u64)naive_eliminate(load(s)).second; });
+		harness::differential(label + " inverse", shapes,
+			[&](const shape& s) {
+				auto x{load(s)};
+				if (s[0] != s[1]) {
+					return u64{2};
+				}
+				auto inv{concrete::inverse(x)};
+				if (!inv) {
+					return u64{0};
+				}
+				concrete::matrix<T> identity(s[0], s[0]);
+				for (std::size_t i{0}; i != s[0]; ++i) {
+					identity[i][i] = T{1};
+				}
+				return (u64)(naive_multiply(x, *inv) == identity && naive_multiply(*inv, x) == identity);
+			},
+			[&](const shape& s) { return s[0] != s[1] ? u64{2} : (u64)(naive_eliminate(load(s)).second == s[0]); });
+	}
+
+	void run() {
+		using mint = concrete::int_m<998244353u>;
+		using mint62 = concrete::int_m<4611686018427387847ull>;
+		using mint63 = concrete::int_m<9223372036854775783ull>;
+		static_multiply<mint, 4, 4, 4>("static_matrix<int_m<998244353>, 4>");
+		static_multiply<mint, 12, 12, 12>("static_matrix<int_m<998244353>, 12>");
+		static_multiply<mint63, 3, 5, 2>("static_matrix<int_m<2^63 - 25>, 3, 5>");
+		static_multiply<u64, 9, 3, 9>("static_matrix<uint64_t, 9, 3>");
+		multiply<mint>("matrix_multiply<int_m<998244353>>");
+		multiply<mint62>("matrix_multiply<int_m<2^62 - 57>>");
+		multiply<mint63>("matrix_multiply<int_m<2^63 - 25>>");
+		multiply<u64>("matrix_multiply<uint64_t>");
+		elimination<mint>("int_m<998244353>");
+		elimination<mint63>("int_m<2^63 - 25>");
+	}
+
+}
+
+namespace semiring_test {
+
+	using harness::u64;
+	using value_type = concrete::int64_t;
+	using min_plus = concrete::semiring_traits<concrete::minimum<value_type>, concrete::add<value_type>>;
+
+	concrete::matrix<value_type> graph(harness::generator& gen, std::size_t n) {
+		std::vector<value_type> potential(n);
+		for (value_type& p : potential) {
+			p = (value_type)gen.below(1000);
+		}
+		concrete::matrix<value_type> res(n, n, min_plus::zero);
+		for (std::size_t i{0}; i != n; ++i) {
+			for (std::size_t j{0}; j != n; ++j) {
+				if ((i < n / 2 || j >= n / 2) && gen.below(8) == 0) {
+					res[i][j] = (value_type)gen.below(100) + potential[i] - potential[j];
+				}
+			}
+		}
+		return res;
+	}
+
+	void multiply() {
+		concrete::matrix<value_type> single(3, 3, min_plus::zero);
+		single[0][1] = -5;
+		auto squared{concrete::semiring_multiply<concrete::minimum<value_type>, concrete::add<value_type>>(single, single)};
+		std::vector<u64> cells{0, 1, 2, 3, 4, 5, 6, 7, 8};
+		harness::differential("min-plus multiply (single negative edge)", cells,
+			[&](u64 i) { return squared.data()[i] == min_plus::zero; },
+			[](u64) { return true; });
+
+		harness::generator gen{"min-plus multiply"};
+		std::size_t n{150};
+		auto x{graph(gen, n)}, y{graph(gen, n)};
+		auto z{concrete::semiring_multiply<concrete::minimum<value_type>, concrete::add<value_type>>(x, y)};
+		std::vector<u64> indices(n * n);
+		for (std::size_t i{0}; i != indices.size(); ++i) {
+			indices[i] = i;
+		}
+		harness::differential("min-plus multiply (negative edges)", indices,
+			[&](u64 i) { return (u64)z.data()[i]; },
+			[&](u64 i) {
+				value_type res{min_plus::zero};
+				for (std::size_t k{0}; k != n; ++k) {
+					if (x[i / n][k] != min_plus::zero && y[k][i % n] != min_plus::zero) {
+						res = std::min(res, x[i / n][k] + y[k][i % n]);
+					}
+				}
+				return (u64)res;
+			});
+	}
+
+	void closure() {
+		harness::generator gen{"min-plus closure"};
+		std::size_t n{150};
+		auto x{graph(gen, n)}, naive{x};
+		concrete::semiring_closure<concrete::minimum<value_type>, concrete::add<value_type>>(x);
+		for (std::size_t i{0}; i != n; ++i) {
+			naive[i][i] = std::min<value_type>(naive[i][i], 0);
+		}
+		for (std::size_t k{0}; k != n; ++k) {
+			for (std::size_t i{0}; i != n; ++i) {
+				for (std::size_t j{0}; j != n; ++j) {
+					if (naive[i][k] != min_plus::zero && naive[k][j] != min_plus::zero) {
+						naive[i][j] = std::min(naive[i][j], naive[i][k] + naive[k][j]);
+					}
+				}
+			}
+		}
+		std::vector<u64> indices(n * n);
+		for (std::size_t i{0}; i != indices.size(); ++i) {
+			indices[i] = i;
+		}
+		harness::differential("min-plus closure (Floyd-Warshall)", indices,
+			[&](u64 i) { return (u64)x.data()[i]; },
+			[&](u64 i) { return (u64)naive.data()[i]; });
+	}
+
+	void run() {
+		multiply();
+		closure();
+	}
+
+}
+
+namespace convolution_test {
+
+	using harness::u64;
+	using shape = std::array<u64, 3>;
+
+	template<class T>
+	std::vector<T> random_vector(std::mt19937_64& eng, std::size_t size) {
+		std::vector<T> res(size);
+		for (T& x : res) {
+			u64 r{eng() % 8};
+			x = T{(typename T::value_type)(r == 0 ? 0 : r == 1 ? (u64)T{}.modular_arithmetic().modulo() - 1 : eng())};
+		}
+		return res;
+	}
+
+	template<class T>
+	void run(const std::string& label) {
+		harness::generator gen{label};
+		std::vector<shape> shapes{{1, 1, 0}, {64, 64, 0}, {63, 2000, 0}, {64, 1, 0}, {2048, 2049, 0}, {1000, 1000, 1}, {4096, 4096, 1}};
+		for (std::size_t i{0}, n{harness::count(64)}; i != n; ++i) {
+			u64 size{gen.below(4) == 0 ? 1 + gen.below(3000) : 1 + gen.below(200)};
+			shapes.push_back({size, 1 + gen.below(gen.below(2) == 0 ? 3000 : 200), gen.below(4) == 0});
+		}
+		auto load{[](const shape& s) {
+			std::mt19937_64 eng{harness::seed ^ s[0] << 32 ^ s[1]};
+			std::vector<T> x{random_vector<T>(eng, s[0])};
+			return std::pair{x, s[2] != 0 ? x : random_vector<T>(eng, s[1])};
+		}};
+		harness::differential(label, shapes,
+			[&](const shape& s) {
+				auto [x, y]{load(s)};
+				return harness::fold(s[2] != 0 ? concrete::convolution(x, x) : concrete::convolution(x, y));
+			},
+			[&](const shape& s) {
+				auto [x, y]{load(s)};
+				std::vector<T> res(x.size() + y.size() - 1);
+				for (std::size_t i{0}; i != x.size(); ++i) {
+					for (std::size_t j{0}; j != y.size(); ++j) {
+						res[i + j] += x[i] * y[j];
+					}
+				}
+				return harness::fold(res);
+			});
+	}
+
+	void run() {
+		run<concrete::int_m<998244353u>>("convolution<int_m<998244353>> (NTT)");
+		run<concrete::int_m<1000000007u>>("convolution<int_m<10^9 + 7>> (Garner)");
+		run<concrete::int_m<2147483647u>>("convolution<int_m<2^31 - 1>> (Garner)");
+	}
+
+}
+
+namespace linear_recurrence_test {
+
+	using harness::u64;
+
+	template<class T>
+	void run(const std::string& label) {
+		harness::generator gen{label};
+		for (std::size_t order : {1, 2, 17, 63, 64, 150}) {
+			std::vector<T> coefficients(order), terms(order);
+			for (T& c : coefficients) {
+				c = T{(typename T::value_type)gen()};
+			}
+			for (T& t : terms) {
+				t = T{(typename T::value_type)gen()};
+			}
+			std::size_t length{8 * order + 4096};
+			for (std::size_t n{order}; n != length; ++n) {
+				T t{0};
+				for (std::size_t i{0}; i != order; ++i) {
+					t += coefficients[i] * terms[n - 1 - i];
+				}
+				terms.push_back(t);
+			}
+			std::string suffix{"<" + label + "> (order " + std::to_string(order) + ")"};
+			std::vector<u64> orders{order};
+			harness::differential("berlekamp_massey" + suffix, orders,
+				[&](u64) { return harness::fold(concrete::berlekamp_massey(std::vector<T>(terms.begin(), terms.begin() + 2 * order))); },
+				[&](u64) { return harness::fold(coefficients); });
+
+			concrete::linear_recurrence<T> recurrence{std::vector<T>(terms.begin(), terms.begin() + 2 * order)};
+			std::vector<u64> ns{0, order - 1, order, length - 1};
+			for (std::size_t i{0}, n{harness::count(256)}; i != n; ++i) {
+				ns.push_back(gen.below(length));
+			}
+			harness::differential("linear_recurrence" + suffix, ns, [&](u64 n) { return harness::fold(recurrence(n)); }, [&](u64 n) { return harness::fold(terms[n]); });
+			harness::differential("linear_recurrence<" + label + "> (batch " + std::to_string(order) + ")", orders,
+				[&](u64) { return harness::fold(recurrence(ns)); },
+				[&](u64) {
+					std::vector<T> res;
+					for (u64 n : ns) {
+						res.push_back(terms[n]);
+					}
+					return harness::fold(res);
+				});
+
+			std::vector<T> padded(terms.begin(), terms.begin() + order / 2);
+			padded.resize(length);
+			for (std::size_t n{order}; n != length; ++n) {
+				for (std::size_t i{0}; i != order; ++i) {
+					padded[n] += coefficients[i] * padded[n - 1 - i];
+				}
+			}
+			concrete::linear_recurrence<T> truncated{std::vector<T>(terms.begin(), terms.begin() + order / 2), coefficients};
+			harness::differential("linear_recurrence<" + label + "> (short " + std::to_string(order) + ")", ns,
+				[&](u64 n) { return harness::fold(truncated(n)); }, [&](u64 n) { return harness::fold(padded[n]); });
+		}
+	}
+
+	void run() {
+		run<concrete::int_m<998244353u>>("998244353");
+		run<concrete::int_m<1000000007u>>("10^9 + 7");
+	}
+
+}
+
+namespace wide_integer_test {
+
+	using harness::u64;
+	using harness::u128;
+	using i128 = concrete::int128_t;
+	using quintuple = std::array<u64, 5>;
+
+	u128 wide(harness::generator& gen) {
+		switch (gen.below(6)) {
+		case 0:
+			return (u128)gen.any();
+		case 1:
+			return ~(u128)0 - gen.below(4);
+		case 2:
+			return (u128)1 << 127 | gen.below(4);
+		default:
+			return (u128)gen.any() << 64 | gen();
+		}
+	}
+
+	template<class T, class N>
+	N evaluate(u64 op, N x, N y, u64 shift) {
+		using U = std::conditional_t<std::is_same_v<T, N>, u128, T>;
+		T a{x}, b{y};
+		U c{(U)x}, d{(U)y};
+		switch (op) {
+		case 0:
+			return (N)(c + d);
+		case 1:
+			return (N)(c - d);
+		case 2:
+			return (N)(c * d);
+		case 3:
+			return (N)(a / b);
+		case 4:
+			return (N)(a % b);
+		case 5:
+			return (N)((a & b) ^ (a | ~b));
+		case 6:
+			return (N)(c << (unsigned)shift);
+		case 7:
+			return (N)(a >> (unsigned)shift);
+		case 8:
+			return (N)(-c);
+		default:
+			return (N)((a < b) | (a <= b) << 1 | (a == b) << 2 | (a != b) << 3 | (a > b) << 4 | (a >= b) << 5);
+		}
+	}
+
+	template<class T, class N>
+	void run(const std::string& label) {
+		harness::generator gen{label};
+		std::vector<quintuple> inputs;
+		for (std::size_t i{0}, n{harness::count(1 << 18)}; i != n; ++i) {
+			u128 x{wide(gen)}, y{wide(gen)};
+			u64 op{gen.below(10)};
+			if ((op == 3 || op == 4) && (y == 0 || (concrete::is_signed_v<N> && (N)y == (N)-1))) {
+				y = 3;
+			}
+			inputs.push_back({op | gen.below(128) << 8, (u64)(x >> 64), (u64)x, (u64)(y >> 64), (u64)y});
+		}
+		auto unpack{[](const quintuple& x) { return std::array<N, 2>{(N)((u128)x[1] << 64 | x[2]), (N)((u128)x[3] << 64 | x[4])}; }};
+		harness::differential(label, inputs,
+			[&](const quintuple& x) { auto v{unpack(x)}; return harness::fold((u128)evaluate<T, N>(x[0] & 0xff, v[0], v[1], x[0] >> 8)); },
+			[&](const quintuple& x) { auto v{unpack(x)}; return harness::fold((u128)evaluate<N, N>(x[0] & 0xff, v[0], v[1], x[0] >> 8)); });
+	}
+
+	template<class T, class N>
+	constexpr bool same_limits() {
+		using lhs = std::numeric_limits<T>;
+		using rhs = std::numeric_limits<N>;
+		return lhs::is_specialized == rhs::is_specialized && lhs::is_signed == rhs::is_signed && lhs::is_integer == rhs::is_integer
+			&& lhs::is_exact == rhs::is_exact && lhs::has_infinity == rhs::has_infinity && lhs::has_quiet_NaN == rhs::has_quiet_NaN
+			&& lhs::has_signaling_NaN == rhs::has_signaling_NaN && lhs::has_denorm == rhs::has_denorm && lhs::has_denorm_loss == rhs::has_denorm_loss
+			&& lhs::round_style == rhs::round_style && lhs::is_iec559 == rhs::is_iec559 && lhs::is_bounded == rhs::is_bounded
+			&& lhs::is_modulo == rhs::is_modulo && lhs::digits == rhs::digits && lhs::digits10 == rhs::digits10
+			&& lhs::max_digits10 == rhs::max_digits10 && lhs::radix == rhs::radix && lhs::min_exponent == rhs::min_exponent
+			&& lhs::min_exponent10 == rhs::min_exponent10 && lhs::max_exponent == rhs::max_exponent && lhs::max_exponent10 == rhs::max_exponent10
+			&& lhs::traps == rhs::traps && lhs::tinyness_before == rhs::tinyness_before
+			&& (N)lhs::min() == rhs::min() && (N)lhs::max() == rhs::max() && (N)lhs::lowest() == rhs::lowest() && (N)lhs::epsilon() == rhs::epsilon()
+			&& (N)lhs::round_error() == rhs::round_error() && (N)lhs::infinity() == rhs::infinity() && (N)lhs::denorm_min() == rhs::denorm_min();
+	}
+
+	static_assert(same_limits<concrete::wide_integer<false, 16>, u128>() && same_limits<concrete::wide_integer<true, 16>, i128>());
+
+	template<std::size_t size>
+	void division(const std::string& label) {
+		using W = concrete::wide_integer<false, size>;
+		using words = std::array<u64, size / 4>;
+		constexpr std::size_t limbs{size / 8};
+		constexpr u64 top{u64{1} << 63};
+		harness::generator gen{label};
+		std::vector<words> inputs{{0, ~u64{0} - 1, top, 0}};
+		inputs[0][limbs] = ~u64{0};
+		inputs[0][limbs + 1] = top;
+		for (std::size_t i{0}, n{harness::count(1 << 15)}; i != n; ++i) {
+			words w{};
+			for (std::size_t half{0}; half != 2; ++half) {
+				for (std::size_t k{0}, used{1 + gen.below(limbs)}; k != used; ++k) {
+					u64 r{gen.below(6)};
+					w[half * limbs + k] = r == 0 ? 0 : r == 1 ? ~u64{0} : r == 2 ? top : r == 3 ? top - 1 : gen();
+				}
+			}
+			w[limbs] |= std::all_of(w.begin() + limbs, w.end(), [](u64 x) { return x == 0; });
+			inputs.push_back(w);
+		}
+		auto unpack{[](const words& w, std::size_t offset) { W res; std::copy_n(w.begin() + offset, limbs, res.data()); return res; }};
+		auto fold{[](const W& q, const W& r) {
+			return harness::fold(std::vector<u64>(q.data(), q.data() + limbs)) * 31 ^ harness::fold(std::vector<u64>(r.data(), r.data() + limbs));
+		}};
+		harness::differential(label, inputs,
+			[&](const words& w) { W x{unpack(w, 0)}, y{unpack(w, limbs)}; return fold(x / y, x % y); },
+			[&](const words& w) {
+				W x{unpack(w, 0)}, y{unpack(w, limbs)}, q{0}, r{0};
+				for (int i{(int)size * 8 - 1}; i >= 0; --i) {
+					r <<= 1;
+					r |= x >> (unsigned)i & W{1};
+					if (r >= y) {
+						r -= y;
+						q |= W{1} << (unsigned)i;
+					}
+				}
+				return fold(q, r);
+			});
+	}
+
+	void run() {
+		run<concrete::wide_integer<false, 16>, u128>("wide_integer<false, 16> vs uint128_t");
+		run<concrete::wide_integer<true, 16>, i128>("wide_integer<true, 16> vs int128_t");
+		division<32>("wide_integer<false, 32> division");
+		division<64>("wide_integer<false, 64> division");
+	}
+
+}
+
+namespace big_integer_test {
+
+	using harness::u64;
+	using harness::u128;
+	using i128 = concrete::int128_t;
+	using limbs = std::vector<u64>;
+	using shape = std::array<u64, 3>;
+
+	limbs multiply(const limbs& x, const limbs& y) {
+		limbs res(x.size() + y.size());
+		for (std::size_t i{0}; i != x.size(); ++i) {
+			u64 carry{0};
+			for (std::size_t j{0}; j != y.size(); ++j) {
+				u128 t{(u128)x[i] * y[j] + res[i + j] + carry};
+				res[i + j] = (u64)t;
+				carry = (u64)(t >> 64);
+			}
+			res[i + y.size()] = carry;
+		}
+		while (!res.empty() && res.back() == 0) {
+			res.pop_back();
+		}
+		return res;
+	}
+
+	std::string decimal(limbs x) {
+		std::string res;
+		while (!x.empty()) {
+			u64 rem{0};
+			for (std::size_t i{x.size()}; i-- != 0;) {
+				u128 t{(u128)rem << 64 | x[i]};
+				x[i] = (u64)(t / 10);
+				rem = (u64)(t % 10);
+			}
+			res.push_back((char)('0' + rem));
+			while (!x.empty() && x.back() == 0) {
+				x.pop_back();
+			}
+		}
+		if (res.empty()) {
+			res.push_back('0');
+		}
+		return {res.rbegin(), res.rend()};
+	}
+
+	limbs random_limbs(std::mt19937_64& eng, std::size_t size) {
+		limbs res(size);
+		for (u64& x : res) {
+			u64 r{eng() % 8};
+			x = r == 0 ? 0 : r == 1 ? ~u64{0} : eng();
+		}
+		if (size != 0 && res.back() == 0) {
+			res.back() = 1;
+		}
+		return res;
+	}
+
+	concrete::big_integer make(const limbs& x, bool negative) {
+		concrete::big_integer res;
+		for (std::size_t i{x.size()}; i-- != 0;) {
+			res = (res << 64) + concrete::big_integer{x[i]};
+		}
+		return negative ? -res : res;
+	}
+
+	concrete::big_integer magnitude(const concrete::big_integer& x) {
+		return x.is_negative() ? -x : x;
+	}
+
+	void small() {
+		harness::generator gen{"big_integer (small)"};
+		std::vector<std::array<u64, 3>> inputs;
+		for (std::size_t i{0}, n{harness::count(1 << 17)}; i != n; ++i) {
+			inputs.push_back({gen.below(8) | gen.below(128) << 8, gen.any() >> 2, gen.any() >> 2});
+		}
+		auto operands{[](const std::array<u64, 3>& x) {
+			i128 a{(i128)(concrete::int64_t)(x[1] << 1) >> 1}, b{(i128)(concrete::int64_t)(x[2] << 1) >> 1};
+			return std::array<i128, 2>{a, b == 0 ? 7 : b};
+		}};
+		harness::differential("big_integer (small) vs int128_t", inputs,
+			[&](const std::array<u64, 3>& x) {
+				auto v{operands(x)};
+				concrete::big_integer a{v[0]}, b{v[1]};
+				unsigned shift{(unsigned)(x[0] >> 8) % 60};
+				switch (x[0] & 0xff) {
+				case 0:
+					return harness::fold((u128)(i128)(a + b));
+				case 1:
+					return harness::fold((u128)(i128)(a - b));
+				case 2:
+					return harness::fold((u128)(i128)(a * b));
+				case 3:
+					return harness::fold((u128)(i128)(a / b));
+				case 4:
+					return harness::fold((u128)(i128)(a % b));
+				case 5:
+					return harness::fold((u128)(i128)(a << shift));
+				case 6:
+					return harness::fold((u128)(i128)(a >> shift));
+				default:
+					return (u64)((a < b) | (a <= b) << 1 | (a == b) << 2 | (a > b) << 3 | (a >= b) << 4 | (bool)a << 5);
+				}
+			},
+			[&](const std::array<u64, 3>& x) {
+				auto v{operands(x)};
+				i128 a{v[0]}, b{v[1]};
+				unsigned shift{(unsigned)(x[0] >> 8) % 60};
+				switch (x[0] & 0xff) {
+				case 0:
+					return harness::fold((u128)(a + b));
+				case 1:
+					return harness::fold((u128)(a - b));
+				case 2:
+					return harness::fold((u128)(a * b));
+				case 3:
+					return harness::fold((u128)(a / b));
+				case 4:
+					return harness::fold((u128)(a % b));
+				case 5:
+					return harness::fold((u128)a << shift);
+				case 6:
+					return harness::fold((u128)(a >> shift));
+				default:
+					return (u64)((a < b) | (a <= b) << 1 | (a == b) << 2 | (a > b) << 3 | (a >= b) << 4 | (a != 0) << 5);
+				}
+			});
+	}
+
+	void large() {
+		harness::generator gen{"big_integer (large)"};
+		std::vector<shape> shapes{{0, 5, 0}, {1, 1, 1}, {32, 33, 2}, {100, 7, 3}, {4096, 4100, 4}, {5000, 5000, 5}};
+		for (std::size_t i{0}, n{harness::count(96)}; i != n; ++i) {
+			u64 size{gen.below(3) == 0 ? 1 + gen.below(600) : 1 + gen.below(70)};
+			shapes.push_back({size, 1 + gen.below(gen.below(2) == 0 ? 600 : 70), gen()});
+		}
+		auto load{[](const shape& s) {
+			std::mt19937_64 eng{harness::seed ^ s[2]};
+			limbs x{random_limbs(eng, s[0])};
+			return std::pair{x, random_limbs(eng, s[1])};
+		}};
+		harness::differential("big_integer multiply", shapes,
+			[&](const shape& s) {
+				auto [x, y]{load(s)};
+				concrete::big_integer z{make(x, s[2] & 1) * make(y, s[2] & 2)};
+				return harness::fold(z.data()) ^ z.is_negative();
+			},
+			[&](const shape& s) {
+				auto [x, y]{load(s)};
+				limbs z{multiply(x, y)};
+				return harness::fold(z) ^ (!z.empty() && ((s[2] & 1) != 0) != ((s[2] & 2) != 0));
+			});
+		harness::differential("big_integer divide", shapes,
+			[&](const shape& s) {
+				auto [x, y]{load(s)};
+				concrete::big_integer a{make(x, s[2] & 1)}, b{make(y, s[2] & 2)};
+				if (!b) {
+					return true;
+				}
+				concrete::big_integer q{a / b}, r{a % b};
+				return q * b + r == a && magnitude(r) < magnitude(b) && (!r || r.is_negative() == a.is_negative());
+			},
+			[](const shape&) { return true; });
+		harness::differential("big_integer to_string", shapes,
+			[&](const shape& s) {
+				auto [x, y]{load(s)};
+				if (s[0] > 1000) {
+					return u64{0};
+				}
+				std::string text{make(x, s[2] & 1).to_string()};
+				return (u64)std::hash<std::string>{}(text) ^ (concrete::big_integer{text} == make(x, s[2] & 1));
+			},
+			[&](const shape& s) {
+				auto [x, y]{load(s)};
+				if (s[0] > 1000) {
+					return u64{0};
+				}
+				return (u64)std::hash<std::string>{}((s[2] & 1) != 0 && !x.empty() ? "-" + decimal(x) : decimal(x)) ^ 1;
+			});
+	}
+
+	std::string text(u64 code) {
+		constexpr std::string_view alphabet{"0123456789+- a"};
+		std::string res;
+		for (u64 length{code & 7}, rest{code >> 3}; length-- != 0; rest /= alphabet.size()) {
+			res.push_back(alphabet[rest % alphabet.size()]);
+		}
+		return res;
+	}
+
+	void parse() {
+		harness::generator gen{"big_integer from_string"};
+		std::vector<u64> codes;
+		for (u64 length{0}; length != 3; ++length) {
+			for (u64 rest{0}; rest != (length == 0 ? 1 : length == 1 ? 14 : 196); ++rest) {
+				codes.push_back(rest << 3 | length);
+			}
+		}
+		for (std::size_t i{0}, n{harness::count(1 << 14)}; i != n; ++i) {
+			codes.push_back(gen.below(1ull << 40) << 3 | gen.below(8));
+		}
+		harness::differential("big_integer from_string", codes,
+			[](u64 code) {
+				std::string s{text(code)};
+				std::optional<concrete::big_integer> x{concrete::big_integer::from_string(s)};
+				return x ? (u64)(i128)*x << 1 ^ (u64)(concrete::big_integer{s} == *x) << 63 : ~u64{0} ^ (u64)!concrete::big_integer{s};
+			},
+			[](u64 code) {
+				std::string s{text(code)};
+				std::size_t first{!s.empty() && (s[0] == '-' || s[0] == '+')};
+				bool valid{first != s.size()};
+				i128 value{0};
+				for (std::size_t i{first}; i != s.size(); ++i) {
+					valid = valid && s[i] >= '0' && s[i] <= '9';
+					value = value * 10 + (s[i] - '0');
+				}
+				value = first == 1 && s[0] == '-' ? -value : value;
+				return valid ? (u64)value << 1 ^ u64{1} << 63 : ~u64{1};
+			});
+	}
+
+	void run() {
+		small();
+		large();
+		parse();
+	}
+
+}
+
+int main(int argc, char** argv) {
+	for (int i{1}; i != argc; ++i) {
+		if (std::strncmp(argv[i], "--seed=", 7) == 0) {
+			harness::seed = std::strtoull(argv[i] + 7, nullptr, 0);
+		}
+		else if (std::strncmp(argv[i], "--scale=", 8) == 0) {
+			harness::scale = std::strtod(argv[i] + 8, nullptr);
+		}
+	}
+	std::cout << "seed " << harness::seed << ", scale " << harness::scale << ", threads " << concrete::detail::parallel::hardware_threads() << '\n';
+
+	math_test::run();
+	modular_test::run();
+	fenwick_tree_test::run();
+	fast_io_test::run();
+	random_test::run();
+	rolling_hash_test::run();
+	hash_map_test::run();
+	standard_test::run();
+	bit_vector_test::run();
+	numeric_test::run();
+	sparse_table_test::run();
+	segment_tree_test::run();
+	matrix_test::run();
+	semiring_test::run();
+	convolution_test::run();
+	linear_recurrence_test::run();
+	wide_integer_test::run();
+	big_integer_test::run();
+
+	return harness::failures == 0 ? 0 : 1;
+}
\ No newline at end of file